@@ -16,6 +16,10 @@
 //	static_assert(WITH_PUSH_MODEL == 1);
 //#endif
 
+DECLARE_CYCLE_STAT(TEXT("Core Attributes Post Effect Execute"), STAT_CoreAttributesPostEffectExecute, STATGROUP_Game);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Core Attribute Executes Handled"), STAT_CoreAttributeExecutesHandled, STATGROUP_Game);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Core Attribute Executes Skipped"), STAT_CoreAttributeExecutesSkipped, STATGROUP_Game);
+
 UCoreAttributeSet::UCoreAttributeSet()
 	: Health(1.f)
 	, MaxHealth(1.f)
@@ -96,6 +100,11 @@ UCoreAttributeSet::UCoreAttributeSet()
 		{ GetVenomRateAttribute(),  FPOTAdjustCurrentAttribute(nullptr, &NAME_DebuffEnvenomed, 0.f, true)},
 	};
 
+	for (TPair<const FGameplayAttribute, FPOTAdjustCurrentAttribute>& CurrentAdjust : AdjustForCurrentAttributes)
+	{
+		CurrentAdjust.Value.CapName = FName(CurrentAdjust.Key.GetName());
+	}
+
 	// Status Handling: Will call all relevant methods assiociated with the status.
 	CallForStatusHandling = {
 		{ GetBleedingRateAttribute(), FPOTStatusHandling(EDamageEffectType::BLEED, true, true) },
@@ -110,8 +119,27 @@ UCoreAttributeSet::UCoreAttributeSet()
 		{ GetIncomingPoisonRateAttribute(), FPOTIncomingStatusHandling(EDamageEffectType::POISONED, GetIncomingPoisonRateAttribute(), GetPoisonRateAttribute(), &UCoreAttributeSet::SetIncomingPoisonRate, &UCoreAttributeSet::SetPoisonRate) },
 		{ GetIncomingVenomRateAttribute(), FPOTIncomingStatusHandling(EDamageEffectType::VENOM, GetIncomingVenomRateAttribute(), GetVenomRateAttribute(),&UCoreAttributeSet::SetIncomingVenomRate, &UCoreAttributeSet::SetVenomRate) }
 	};	
+
+	for (const TPair<const FGameplayAttribute, FPOTStatusHandling>& StatusHandling : CallForStatusHandling)
+	{
+		PostExecuteHandlers.Add(StatusHandling.Key, EPOTExecuteContext::None);
+	}
+
+	for (const TPair<const FGameplayAttribute, FPOTIncomingStatusHandling>& IncomingStatusHandling : CallForIncomingStatusHandling)
+	{
+		PostExecuteHandlers.Add(IncomingStatusHandling.Key, EPOTExecuteContext::HitResult);
+	}
 	
 #endif
+
+	// Anything not in here (regen, hunger, thirst, oxygen, ...) has nothing to do in PostGameplayEffectExecute
+	PostExecuteHandlers.Add(GetIncomingDamageAttribute(), EPOTExecuteContext::All);
+	PostExecuteHandlers.Add(GetIncomingSurvivalDamageAttribute(), EPOTExecuteContext::All);
+	PostExecuteHandlers.Add(GetHealthAttribute(), EPOTExecuteContext::HitResult);
+	PostExecuteHandlers.Add(GetIncomingBoneBreakAmountAttribute(), EPOTExecuteContext::HitResult | EPOTExecuteContext::TargetState);
+	PostExecuteHandlers.Add(GetWellRestedBonusMultiplierAttribute(), EPOTExecuteContext::None);
+	PostExecuteHandlers.Add(GetLegDamageAttribute(), EPOTExecuteContext::None);
+	PostExecuteHandlers.Add(GetCurrentBodyFoodAmountAttribute(), EPOTExecuteContext::None);
 }
 
 // BEGIN - STATUS_UPDATE_MARKER - Macro Attribute Accessors
@@ -286,7 +314,12 @@ void UCoreAttributeSet::HandleIncomingStatusAttributeChange(const float DeltaVal
 
 float UCoreAttributeSet::FindAttributeCapFromConfig(const FGameplayAttribute& Attribute)
 {
-	return AttributeCaps.FindRef(FName(Attribute.GetName()));
+	return FindAttributeCapFromConfigByName(FName(Attribute.GetName()));
+}
+
+float UCoreAttributeSet::FindAttributeCapFromConfigByName(const FName& AttributeName)
+{
+	return AttributeCaps.FindRef(AttributeName);
 }
 
 void UCoreAttributeSet::OnRep_AttributeCapsConfig()
@@ -698,20 +731,73 @@ void UCoreAttributeSet::OnRep_HealthRecoveryMultiplier(const FGameplayAttributeD
 	GAMEPLAYATTRIBUTE_REPNOTIFY(UCoreAttributeSet, HealthRecoveryMultiplier, OldValue);
 }
 
+const FGameplayTagContainer& UCoreAttributeSet::GetDebuffTagsToRemove()
+{
+	static const FGameplayTagContainer DebuffTags = []()
+	{
+		FGameplayTagContainer Tags;
+		for (const FName& Name : DebuffTagsToRemove)
+		{
+			const FGameplayTag Tag = FGameplayTag::RequestGameplayTag(Name, false);
+			if (Tag.IsValid())
+			{
+				Tags.AddTagFast(Tag);
+			}
+		}
+		return Tags;
+	}();
+
+	return DebuffTags;
+}
+
 void UCoreAttributeSet::UpdateTagBasedOnAttribute(const FGameplayAttribute& Attribute, const float NewValue, const FName& TagName)
+{
+	// Entry point for external callers, PreAttributeChange goes straight to UpdateTagBasedOnAttributeTag.
+	// Debuff names from AdjustForCurrentAttributes use their pre-resolved tag, anything else is looked up.
+	FPOTAdjustCurrentAttribute* CurrentAdjust = AdjustForCurrentAttributes.Find(Attribute);
+	const bool bIsAdjustDebuff = CurrentAdjust && CurrentAdjust->DebuffName && *CurrentAdjust->DebuffName == TagName;
+	const FGameplayTag Tag = bIsAdjustDebuff ? ResolveDebuffTag(*CurrentAdjust) : FGameplayTag::RequestGameplayTag(TagName, false);
+
+	if (!Tag.IsValid())
+	{
+		if (!bIsAdjustDebuff)
+		{
+			UE_LOG(TitansLog, Error, TEXT("UCoreAttributeSet::UpdateTagBasedOnAttribute - No Tag found for %s, abort."), *TagName.ToString());
+		}
+		return;
+	}
+
+	UpdateTagBasedOnAttributeTag(Attribute, NewValue, Tag);
+}
+
+const FGameplayTag& UCoreAttributeSet::ResolveDebuffTag(FPOTAdjustCurrentAttribute& CurrentAdjust)
+{
+	if (!CurrentAdjust.bDebuffTagResolved && CurrentAdjust.DebuffName)
+	{
+		CurrentAdjust.bDebuffTagResolved = true;
+		CurrentAdjust.DebuffTag = FGameplayTag::RequestGameplayTag(*CurrentAdjust.DebuffName, false);
+
+		if (!CurrentAdjust.DebuffTag.IsValid())
+		{
+			UE_LOG(TitansLog, Error, TEXT("UCoreAttributeSet::ResolveDebuffTag - No Tag found for %s, debuff tag updates for it are skipped."), *CurrentAdjust.DebuffName->ToString());
+		}
+	}
+
+	return CurrentAdjust.DebuffTag;
+}
+
+void UCoreAttributeSet::UpdateTagBasedOnAttributeTag(const FGameplayAttribute& Attribute, const float NewValue, const FGameplayTag& Tag)
 {
 	if (AActor* OwningActor = GetOwningActor())
 	{
 		if (AIBaseCharacter* BaseOwningCharacter = Cast<AIBaseCharacter>(OwningActor))
 		{
-			FGameplayTagContainer GameplayTags = BaseOwningCharacter->CharacterTags;
-			const FGameplayTag Tag = FGameplayTag::RequestGameplayTag(TagName);
+			FGameplayTagContainer& GameplayTags = BaseOwningCharacter->CharacterTags;
 
 			if (!Tag.IsValid())
 			{
-				UE_LOG(TitansLog, Error, TEXT("UCoreAttributeSet::UpdateTagBasedOnAttribute - No Tag found for %s, abort."), *TagName.ToString());
 				return;
-					}
+			}
 
 			if (Attribute == GetHealthAttribute())
 			{
@@ -723,14 +809,7 @@ void UCoreAttributeSet::UpdateTagBasedOnAttribute(const FGameplayAttribute& Attr
 					//Also remove all debuff status tags since we have died
 					//@TODO Might want to remove buff as well
 					
-					for (const FName& Name : DebuffTagsToRemove)
-					{
-						FGameplayTag TagToRemove = FGameplayTag::RequestGameplayTag(Name);
-						if (TagToRemove.IsValid() && GameplayTags.HasTag(TagToRemove))
-						{
-							GameplayTags.RemoveTag(TagToRemove);
-						}
-					}
+					GameplayTags.RemoveTags(GetDebuffTagsToRemove());
 				}
 				else if (NewValue > 0 && GameplayTags.HasTag(Tag))
 				{
@@ -752,8 +831,6 @@ void UCoreAttributeSet::UpdateTagBasedOnAttribute(const FGameplayAttribute& Attr
 					GameplayTags.RemoveTag(Tag);
 				}
 			}
-
-			BaseOwningCharacter->CharacterTags = GameplayTags;
 		}
 	}
 }
@@ -779,13 +856,14 @@ void UCoreAttributeSet::PreAttributeChange(const FGameplayAttribute& Attribute,
 		return;
 	}
 
-	if (const FPOTAdjustCurrentAttribute* CurrentAdjust = AdjustForCurrentAttributes.Find(Attribute))
+	if (FPOTAdjustCurrentAttribute* CurrentAdjust = AdjustForCurrentAttributes.Find(Attribute))
 	{
 		GetNewAttributeVsCapValue(*CurrentAdjust, Attribute, NewValue);
 
+		// The entry is already in hand, so skip the by-name lookup in UpdateTagBasedOnAttribute
 		if (CurrentAdjust->DebuffName)
 		{
-			UpdateTagBasedOnAttribute(Attribute, NewValue, *CurrentAdjust->DebuffName);
+			UpdateTagBasedOnAttributeTag(Attribute, NewValue, ResolveDebuffTag(*CurrentAdjust));
 		}
 	}
 }
@@ -802,7 +880,7 @@ void UCoreAttributeSet::GetNewAttributeVsCapValue(const FPOTAdjustCurrentAttribu
 				Max = CurrentAdjust.MaxAttribute->GetCurrentValue();
 			} else if (CurrentAdjust.FetchMaxFromConfig)
 			{
-				Max = FindAttributeCapFromConfig(Attribute);
+				Max = CurrentAdjust.CapName.IsNone() ? FindAttributeCapFromConfig(Attribute) : FindAttributeCapFromConfigByName(CurrentAdjust.CapName);
 			} else
 			{
 				Max = CurrentAdjust.MaxValue;
@@ -851,15 +929,24 @@ bool UCoreAttributeSet::PreGameplayEffectExecute(FGameplayEffectModCallbackData
 
 void UCoreAttributeSet::PostGameplayEffectExecute(const FGameplayEffectModCallbackData& Data)
 {
+	SCOPE_CYCLE_COUNTER(STAT_CoreAttributesPostEffectExecute);
+
 	Super::PostGameplayEffectExecute(Data);
 
+	const EPOTExecuteContext* const HandlerContext = PostExecuteHandlers.Find(Data.EvaluatedData.Attribute);
+	if (!HandlerContext)
+	{
+		INC_DWORD_STAT(STAT_CoreAttributeExecutesSkipped);
+		return;
+	}
+
+	INC_DWORD_STAT(STAT_CoreAttributeExecutesHandled);
+
+	const EPOTExecuteContext RequiredContext = *HandlerContext;
+
 	FGameplayEffectContextHandle Context = Data.EffectSpec.GetContext();
-	UAbilitySystemComponent* SourceASC = Context.GetOriginalInstigatorAbilitySystemComponent();
 	const FGameplayTagContainer& SourceTags = *Data.EffectSpec.CapturedSourceTags.GetAggregatedTags();
 
-	FGameplayTagContainer AssetTags;
-	Data.EffectSpec.GetAllAssetTags(AssetTags);
-
 	FPOTGameplayEffectContext* POTEffectContext = Context.Get() != nullptr
 		? StaticCast<FPOTGameplayEffectContext*>(Context.Get())
 		: nullptr;
@@ -896,18 +983,22 @@ void UCoreAttributeSet::PostGameplayEffectExecute(const FGameplayEffectModCallba
 		return;
 	}
 
-	// Try to extract a hit result
-	FHitResult HitResult;
-	if (Context.GetHitResult() != nullptr)
-	{
-		HitResult = *Context.GetHitResult();
-	}
+	// Try to extract a hit result, referenced from the context rather than copied
+	static const FHitResult EmptyHitResult;
+	const FHitResult* const ContextHitResult = EnumHasAnyFlags(RequiredContext, EPOTExecuteContext::HitResult) ? Context.GetHitResult() : nullptr;
+	const FHitResult& HitResult = ContextHitResult ? *ContextHitResult : EmptyHitResult;
 
 	// Get the Source actor
+	UAbilitySystemComponent* SourceASC = nullptr;
 	AActor* SourceActor = nullptr;
 	AController* SourceController = nullptr;
 	AIBaseCharacter* Instigator = nullptr;
 
+	if (EnumHasAnyFlags(RequiredContext, EPOTExecuteContext::Instigator))
+	{
+		SourceASC = Context.GetOriginalInstigatorAbilitySystemComponent();
+	}
+
 	if (SourceASC && SourceASC->AbilityActorInfo.IsValid() && SourceASC->AbilityActorInfo->AvatarActor.IsValid())
 	{
 		SourceActor = SourceASC->AbilityActorInfo->AvatarActor.Get();
@@ -939,8 +1030,9 @@ void UCoreAttributeSet::PostGameplayEffectExecute(const FGameplayEffectModCallba
 
 	const UPOTAbilitySystemGlobals& WASG = UPOTAbilitySystemGlobals::Get();
 
-	const bool bHomecaveBuff = bTargetCharacterIsAssigned && TargetCharacter->IsHomecaveBuffActive();
-	const bool bGodmode = bTargetCharacterIsAssigned && TargetCharacter->GetGodmode();
+	const bool bNeedsTargetState = EnumHasAnyFlags(RequiredContext, EPOTExecuteContext::TargetState);
+	const bool bHomecaveBuff = bNeedsTargetState && bTargetCharacterIsAssigned && TargetCharacter->IsHomecaveBuffActive();
+	const bool bGodmode = bNeedsTargetState && bTargetCharacterIsAssigned && TargetCharacter->GetGodmode();
 	const bool bCanBeDamaged = bGodmode || bHomecaveBuff;
 	const bool bImmuneToKnockBack = bCanBeDamaged || TargetTags.HasTag(WASG.KnockbackImmunityTag);
 	
@@ -29,6 +29,12 @@
 #include "Animation/DinosaurAnimBlueprint.h"
 #include "ITraceUtils.h"
 
+// Seconds between server samples of playing ability montages
+static constexpr float AbilityMontageSampleInterval = 0.1f;
+
+// Seconds a sampled montage can drift from its extrapolated position before it counts as a seek
+static constexpr float AbilityMontageSeekTolerance = 0.1f;
+
 UPOTAbilitySystemComponent::UPOTAbilitySystemComponent()
 {
 	PrimaryComponentTick.bCanEverTick = true;
@@ -40,6 +46,14 @@ UPOTAbilitySystemComponent::UPOTAbilitySystemComponent()
 	bAreIgnoreEventsEnabled = false;
 }
 
+void UPOTAbilitySystemComponent::PostInitProperties()
+{
+	Super::PostInitProperties();
+
+	// Set after the archetype's properties were copied in, assigning it in the constructor would leave every instance pointing at the template
+	AbilityMontages.Owner = this;
+}
+
 void UPOTAbilitySystemComponent::InitializeAbilitySystem(AActor* InOwnerActor, AActor* InAvatarActor, const bool bPreviewOnly)
 {
 	Super::InitializeAbilitySystem(InOwnerActor, InAvatarActor, bPreviewOnly);
@@ -197,6 +211,17 @@ void UPOTAbilitySystemComponent::TickComponent(float DeltaTime, enum ELevelTick
 			bCanFireDamageFinishedEvent = false;
 		}*/
 	}
+
+	// Replicated montages are resampled at a low rate so seeks, section jumps and play rate changes made after the start are resent
+	if (GetAbilityMontages().Num() > 0 && IsOwnerActorAuthoritative())
+	{
+		AbilityMontageSampleTime += DeltaTime;
+		if (AbilityMontageSampleTime >= AbilityMontageSampleInterval)
+		{
+			AbilityMontageSampleTime = 0.f;
+			UpdateReplicatedAbilityMontages(false);
+		}
+	}
 }
 
 void UPOTAbilitySystemComponent::OnActiveGameplayEffectAddedCallback(UAbilitySystemComponent* Target, const FGameplayEffectSpec& SpecApplied, FActiveGameplayEffectHandle ActiveHandle)
@@ -387,22 +412,15 @@ void UPOTAbilitySystemComponent::StopMontage(UGameplayAbility* InAnimatingAbilit
 
 	if (IsOwnerActorAuthoritative())
 	{
-		bool bNeedsDirtying = false;
 		for (int32 Index = GetAbilityMontages().Num() - 1; Index >= 0; Index--)
 		{
-			const FPOTGameplayAbilityRepAnimMontage& RepMontage = GetAbilityMontages()[Index];
-			if (!RepMontage.InnerMontage.AnimMontage || RepMontage.InnerMontage.AnimMontage == Montage)
+			const FPOTAbilityMontageItem& Item = GetAbilityMontages()[Index];
+			if (!Item.AnimMontage || Item.AnimMontage == Montage)
 			{
-				AbilityMontages.RemoveAt(Index);
-				bNeedsDirtying = true;
+				GetAbilityMontages_Mutable().RemoveItemAt(Index);
 			}
 		}
 
-		if (bNeedsDirtying)
-		{
-			MARK_PROPERTY_DIRTY_FROM_NAME(UPOTAbilitySystemComponent, AbilityMontages, this);
-		}
-
 		UpdateReplicatedAbilityMontages(true);
 	}
 }
@@ -430,20 +448,19 @@ float UPOTAbilitySystemComponent::PlayMontage(UGameplayAbility* InAnimatingAbili
 			// Custom ability montage replication. Default UAbilitySystemComponent only supports 1 active ability montage.
 			if (IsOwnerActorAuthoritative())
 			{
-				FPOTGameplayAbilityRepAnimMontage NewRepMontage = FPOTGameplayAbilityRepAnimMontage::Generate();
-				NewRepMontage.InnerMontage.AnimMontage = NewAnimMontage;
-				NewRepMontage.InnerMontage.PlayRate = InPlayRate;
-				NewRepMontage.InnerMontage.PlayInstanceId = 0;
-				NewRepMontage.InnerMontage.SectionIdToPlay = 0;
-				NewRepMontage.InnerMontage.bRepPosition = true;
-				if (NewRepMontage.InnerMontage.AnimMontage && StartSectionName != NAME_None)
+				// Restarting a montage that is already replicated resyncs the existing item instead of adding another
+				FPOTAbilityMontageArray& MutableAbilityMontages = GetAbilityMontages_Mutable();
+				FPOTAbilityMontageItem* Item = MutableAbilityMontages.FindByMontage(NewAnimMontage);
+				if (!Item)
 				{
-					// we add one so INDEX_NONE can be used in the on rep
-					NewRepMontage.InnerMontage.SectionIdToPlay = NewRepMontage.InnerMontage.AnimMontage->GetSectionIndex(StartSectionName) + 1;
+					Item = &MutableAbilityMontages.Items.AddDefaulted_GetRef();
+					Item->AnimMontage = NewAnimMontage;
 				}
-				
-				GetAbilityMontages_Mutable().Add(NewRepMontage);
-				UpdateReplicatedAbilityMontages(true);		
+
+				SampleAbilityMontage(*AnimInstance, *Item, true);
+				MutableAbilityMontages.MarkItemDirty(*Item);
+
+				UpdateReplicatedAbilityMontages(true);
 			}
 			else
 			{
@@ -494,10 +511,10 @@ TArray<UAnimMontage*> UPOTAbilitySystemComponent::GetActiveMontages() const
 	
 	for (int32 Index = GetAbilityMontages().Num() - 1; Index >= 0; Index--)
 	{
-		const FPOTGameplayAbilityRepAnimMontage& RepMontage = GetAbilityMontages()[Index];
-		if (RepMontage.InnerMontage.AnimMontage)
+		const FPOTAbilityMontageItem& Item = GetAbilityMontages()[Index];
+		if (Item.AnimMontage)
 		{
-			Montages.Add(RepMontage.InnerMontage.AnimMontage);
+			Montages.Add(Item.AnimMontage);
 		}
 	}
 	
@@ -515,48 +532,67 @@ void UPOTAbilitySystemComponent::UpdateReplicatedAbilityMontages(bool bForceNetU
 
 	bool bNeedNetUpdate = bForceNetUpdate;
 
-	TArray<FPOTGameplayAbilityRepAnimMontage>& MutableAbilityMontages = GetAbilityMontages_Mutable();
-	for (int32 Index = MutableAbilityMontages.Num() - 1; Index >= 0; Index --)
+	// Only dirty the property when an item actually changes, a montage that is just playing on doesn't need to be resent
+	for (int32 Index = GetAbilityMontages().Num() - 1; Index >= 0; Index--)
 	{
-		FPOTGameplayAbilityRepAnimMontage& RepMontage = MutableAbilityMontages[Index];
-		if (!RepMontage.InnerMontage.AnimMontage)
+		FPOTAbilityMontageItem& Item = AbilityMontages.Items[Index];
+		if (!Item.AnimMontage || AnimInstance->Montage_GetIsStopped(Item.AnimMontage))
 		{
-			MutableAbilityMontages.RemoveAt(Index);
+			GetAbilityMontages_Mutable().RemoveItemAt(Index);
+			bNeedNetUpdate = true;
 			continue;
 		}
-		
-		if (RepMontage.InnerMontage.AnimMontage == MontageToUpdate)
-		{
-			// Regenerate this to get a new unique id for replication
-			FPOTGameplayAbilityRepAnimMontage NewMontage = FPOTGameplayAbilityRepAnimMontage::Generate();
-			NewMontage.InnerMontage = RepMontage.InnerMontage;
-			RepMontage = NewMontage;
-		}
-
-		const bool bIsStopped = AnimInstance->Montage_GetIsStopped(RepMontage.InnerMontage.AnimMontage);
 
-		if (RepMontage.InnerMontage.IsStopped != bIsStopped)
+		if (SampleAbilityMontage(*AnimInstance, Item, Item.AnimMontage == MontageToUpdate))
 		{
-			RepMontage.InnerMontage.IsStopped = bIsStopped;
+			GetAbilityMontages_Mutable().MarkItemDirty(Item);
 			bNeedNetUpdate = true;
 		}
+	}
+
+	if (bNeedNetUpdate && AbilityActorInfo->AvatarActor != nullptr)
+	{
+		AbilityActorInfo->AvatarActor->ForceNetUpdate();
+	}
+}
+
+bool UPOTAbilitySystemComponent::SampleAbilityMontage(const UAnimInstance& AnimInstance, FPOTAbilityMontageItem& Item, bool bForceResync) const
+{
+	const float PlayRate = AnimInstance.Montage_GetPlayRate(Item.AnimMontage);
+	const int32 SectionIndex = Item.AnimMontage->GetSectionIndex(AnimInstance.Montage_GetCurrentSection(Item.AnimMontage));
+
+	const AGameStateBase* const GameState = GetWorld() ? GetWorld()->GetGameState() : nullptr;
+	const float ServerTime = GameState ? GameState->GetServerWorldTimeSeconds() : 0.f;
+	const float Position = AnimInstance.Montage_GetPosition(Item.AnimMontage);
+
+	if (!bForceResync && SectionIndex == Item.SectionIndex && FMath::IsNearlyEqual(PlayRate, Item.PlayRate, 0.01f))
+	{
+		// Same section and rate, only resync if the montage was seeked away from where clients extrapolate it to
+		float ExpectedPosition = Item.Position + (ServerTime - Item.PositionTime) * Item.PlayRate;
 
-		if (!bIsStopped)
+		float SectionStart = 0.f;
+		float SectionEnd = 0.f;
+		Item.AnimMontage->GetSectionStartAndEndTime(SectionIndex, SectionStart, SectionEnd);
+		const float SectionLength = SectionEnd - SectionStart;
+		if (SectionLength > KINDA_SMALL_NUMBER && ExpectedPosition > SectionEnd)
 		{
-			RepMontage.InnerMontage.PlayRate = AnimInstance->Montage_GetPlayRate(RepMontage.InnerMontage.AnimMontage);
-			RepMontage.InnerMontage.Position = AnimInstance->Montage_GetPosition(RepMontage.InnerMontage.AnimMontage);
-			RepMontage.InnerMontage.BlendTime = AnimInstance->Montage_GetBlendTime(RepMontage.InnerMontage.AnimMontage);
+			// Looping sections wrap, anything else holds at the end of the section
+			ExpectedPosition = AnimInstance.Montage_GetNextSectionID(Item.AnimMontage, SectionIndex) == SectionIndex
+				? SectionStart + FMath::Fmod(ExpectedPosition - SectionStart, SectionLength)
+				: SectionEnd;
 		}
-		else
+
+		if (FMath::Abs(Position - ExpectedPosition) <= AbilityMontageSeekTolerance)
 		{
-			MutableAbilityMontages.RemoveAt(Index);
+			return false;
 		}
 	}
 
-	if (bNeedNetUpdate && AbilityActorInfo->AvatarActor != nullptr)
-	{
-		AbilityActorInfo->AvatarActor->ForceNetUpdate();
-	}
+	Item.PlayRate = PlayRate;
+	Item.Position = Position;
+	Item.PositionTime = ServerTime;
+	Item.SectionIndex = SectionIndex;
+	return true;
 }
 
 bool UPOTAbilitySystemComponent::GetShouldTick() const
@@ -565,52 +601,52 @@ bool UPOTAbilitySystemComponent::GetShouldTick() const
 	return AbilityActorInfo->IsLocallyControlled() || AbilityActorInfo->IsNetAuthority();
 }
 
-void UPOTAbilitySystemComponent::OnRep_AbilityMontages()
+void UPOTAbilitySystemComponent::OnReplicatedAbilityMontageChanged(const FPOTAbilityMontageItem& Item)
 {
-	if (AbilityActorInfo->IsLocallyControlled() || AbilityActorInfo->IsNetAuthority()) return;
+	if (!AbilityActorInfo.IsValid() || AbilityActorInfo->IsLocallyControlled() || AbilityActorInfo->IsNetAuthority()) return;
 
 	UpdateShouldTick();
 
-	UAnimInstance* AnimInstance = AbilityActorInfo.IsValid() ? AbilityActorInfo->GetAnimInstance() : nullptr;
-	if (!ensure(AnimInstance)) return;
+	UAnimInstance* AnimInstance = AbilityActorInfo->GetAnimInstance();
+	if (!AnimInstance || !IsValid(Item.AnimMontage)) return;
 
-	TArray<UAnimMontage*> ActiveMontages{};
+	float Position = Item.Position;
 
-	for (const FPOTGameplayAbilityRepAnimMontage& Montage : GetAbilityMontages())
+	// Items that arrive well after they were sampled (became relevant mid montage) skip ahead to where the server is
+	if (const AGameStateBase* const GameState = GetWorld() ? GetWorld()->GetGameState() : nullptr)
 	{
-		if (!IsValid(Montage.InnerMontage.AnimMontage)) continue;
-
-		if (AnimInstance->Montage_IsPlaying(Montage.InnerMontage.AnimMontage))
+		const float TimeSinceSample = GameState->GetServerWorldTimeSeconds() - Item.PositionTime;
+		if (TimeSinceSample > 0.25f)
 		{
-			AnimInstance->Montage_SetPosition(Montage.InnerMontage.AnimMontage, Montage.InnerMontage.Position);
-			AnimInstance->Montage_SetPlayRate(Montage.InnerMontage.AnimMontage, Montage.InnerMontage.PlayRate);
-		}
-		else
-		{
-			AnimInstance->Montage_Play(Montage.InnerMontage.AnimMontage, Montage.InnerMontage.PlayRate, EMontagePlayReturnType::MontageLength, Montage.InnerMontage.Position, false);
+			Position = FMath::Clamp(Position + TimeSinceSample * Item.PlayRate, 0.f, Item.AnimMontage->GetPlayLength());
 		}
+	}
 
-		ActiveMontages.Add(Montage.InnerMontage.AnimMontage);
+	if (AnimInstance->Montage_IsPlaying(Item.AnimMontage))
+	{
+		AnimInstance->Montage_SetPosition(Item.AnimMontage, Position);
+		AnimInstance->Montage_SetPlayRate(Item.AnimMontage, Item.PlayRate);
+	}
+	else
+	{
+		AnimInstance->Montage_Play(Item.AnimMontage, Item.PlayRate, EMontagePlayReturnType::MontageLength, Position, false);
 	}
+}
 
-#if WITH_EDITOR || UE_BUILD_DEVELOPMENT
-	UE_LOG(TitansLog, Log, TEXT("UPOTAbilitySystemComponent::OnRep_AbilityMontages(): Recieved new AbilityMontages. %i incoming, %i active."), GetAbilityMontages().Num(), ActiveMontages.Num());
-#endif
+void UPOTAbilitySystemComponent::OnReplicatedAbilityMontageRemoved(const FPOTAbilityMontageItem& Item)
+{
+	if (!AbilityActorInfo.IsValid() || AbilityActorInfo->IsLocallyControlled() || AbilityActorInfo->IsNetAuthority()) return;
 
-	for (FAnimMontageInstance* Instance : AnimInstance->MontageInstances)
-	{
-		if (!Instance) continue;
-		UAnimMontage* InstanceMontage = Instance->Montage.Get();
-		if (!InstanceMontage) continue;
+	UAnimInstance* AnimInstance = AbilityActorInfo->GetAnimInstance();
+	if (!AnimInstance || !IsValid(Item.AnimMontage)) return;
 
-		// Need to manually stop any animations that are no longer in the replicated array, otherwise stopping a montage early would not happen on a remote client.
-		if (!ActiveMontages.Contains(InstanceMontage) && !Instance->IsStopped())
-		{
+	// Need to manually stop montages that are no longer replicated, otherwise stopping a montage early would not happen on a remote client.
+	if (AnimInstance->Montage_IsPlaying(Item.AnimMontage))
+	{
 #if WITH_EDITOR || UE_BUILD_DEVELOPMENT
-			UE_LOG(TitansLog, Log, TEXT("UPOTAbilitySystemComponent::OnRep_AbilityMontages(): Stopped stale Ability Montage %s."), *InstanceMontage->GetName());
+		UE_LOG(TitansLog, Log, TEXT("UPOTAbilitySystemComponent::OnReplicatedAbilityMontageRemoved(): Stopped Ability Montage %s."), *Item.AnimMontage->GetName());
 #endif
-			AnimInstance->Montage_Stop(.25f, InstanceMontage);
-		}
+		AnimInstance->Montage_Stop(.25f, Item.AnimMontage);
 	}
 }
 
@@ -622,6 +658,7 @@ void UPOTAbilitySystemComponent::NotifyAbilityEnded(FGameplayAbilitySpecHandle H
 		OnAttackAbilityEnd.Broadcast(CurrentAttackAbility, bWasCancelled);
 		//UE_LOG(LogTemp, Log, TEXT("%s : %s: CurrentAttackAbilityClear - NotifyAbilityEnded"), *GetOwner()->GetName(), *Ability->GetName());
 		CurrentAttackAbility = nullptr;
+		RebuildMovementOverrides();
 
 		SetCurrentAttackAbilityUsesCharge(false);
 	}
@@ -977,6 +1014,7 @@ void UPOTAbilitySystemComponent::SetCurrentAttackingAbility(UPOTGameplayAbility*
 	}
 	
 	CurrentAttackAbility = Ability;
+	RebuildMovementOverrides();
 	OnAttackAbilityStart.Broadcast(CurrentAttackAbility, false);
 
 	bCanFireDamageFinishedEvent = true;
@@ -1443,6 +1481,7 @@ void UPOTAbilitySystemComponent::AddNonExclusiveAbility(UPOTGameplayAbility* Abi
 	if (NonExclusiveAbilities.Contains(Ability)) return;
 
 	NonExclusiveAbilities.Add(Ability);
+	RebuildMovementOverrides();
 }
 
 void UPOTAbilitySystemComponent::RemoveNonExclusiveAbility(UPOTGameplayAbility* Ability)
@@ -1456,77 +1495,192 @@ void UPOTAbilitySystemComponent::RemoveNonExclusiveAbility(UPOTGameplayAbility*
 		if (CurrentAbility == Ability)
 		{
 			NonExclusiveAbilities.RemoveAt(Index);
+			RebuildMovementOverrides();
 			return;
 		}
 	}
 
 }
 
-float UPOTAbilitySystemComponent::GetAbilityForcedMovementSpeed() const
+void UPOTAbilitySystemComponent::RebuildMovementOverrides()
 {
-	float MaxSpeed = 0;
+	const uint32 PreviousVersion = MovementOverrides.Version;
+	MovementOverrides = FPOTMovementOverrideSnapshot();
+	MovementOverrides.Version = PreviousVersion + 1;
+
+	static const FName HasForcedMovementRotationName = GET_FUNCTION_NAME_CHECKED(UPOTGameplayAbility, HasForcedMovementRotation);
 
-	if (CurrentAttackAbility && CurrentAttackAbility->bApplyMovementOverride)
+	auto AddAbility = [this](UPOTGameplayAbility* Ability)
 	{
-		MaxSpeed = CurrentAttackAbility->GetMaxMovementMultiplierSpeed();
+		MovementOverrides.bForcedMovementSpeed |= Ability->bApplyMovementOverride;
+		MovementOverrides.bVerticalControlInWater |= Ability->bAllowVerticalControlInWater;
+		MovementOverrides.bOverrideImmersionDepth |= Ability->bOverrideMovementImmersionDepth;
+
+		if (Ability->bApplyMovementOverride)
+		{
+			MovementOverrides.SpeedOverrideAbilities.Add(Ability);
+		}
+
+		if (Ability->GetClass()->IsFunctionImplementedInScript(HasForcedMovementRotationName))
+		{
+			MovementOverrides.RotationAbilities.Add(Ability);
+		}
+	};
+
+	if (CurrentAttackAbility)
+	{
+		AddAbility(CurrentAttackAbility);
 	}
 
 	for (int Index = NonExclusiveAbilities.Num() - 1; Index >= 0; Index--)
 	{
-		UPOTGameplayAbility* Ability = NonExclusiveAbilities[Index];
-		if (ensure(Ability))
+		if (UPOTGameplayAbility* Ability = NonExclusiveAbilities[Index])
 		{
-			if (!Ability->bApplyMovementOverride) continue;
-			float NewSpeed = Ability->GetMaxMovementMultiplierSpeed();
-			if (NewSpeed > MaxSpeed) MaxSpeed = NewSpeed;
+			AddAbility(Ability);
 		}
 	}
-
-	return MaxSpeed;
 }
 
-bool UPOTAbilitySystemComponent::HasAbilityForcedMovementSpeed() const
+int32 UPOTAbilitySystemComponent::AddAttributeThresholdWatch(const UObject* Owner, const FGameplayAttribute& ValueAttribute, const FGameplayAttribute& MaxAttribute, float Threshold,
+	EPOTAttributeThresholdDirection Direction, FPOTAttributeThresholdCrossed OnCrossed, bool bRequirePositiveMax /*= false*/, float Hysteresis /*= 0.02f*/)
 {
-	if (CurrentAttackAbility && CurrentAttackAbility->bApplyMovementOverride)
+	if (!Owner || !ValueAttribute.IsValid() || !MaxAttribute.IsValid())
 	{
-		return true;
+		return INDEX_NONE;
 	}
 
-	for (int Index = NonExclusiveAbilities.Num() - 1; Index >= 0; Index--)
+	for (const FGameplayAttribute& Attribute : { ValueAttribute, MaxAttribute })
 	{
-		UPOTGameplayAbility* Ability = NonExclusiveAbilities[Index];
-		if (ensure(Ability))
+		if (!AttributeThresholdBoundAttributes.Contains(Attribute))
 		{
-			if (Ability->bApplyMovementOverride)
-			{
-				return true;
-			}
+			AttributeThresholdBoundAttributes.Add(Attribute);
+			GetGameplayAttributeValueChangeDelegate(Attribute).AddUObject(this, &UPOTAbilitySystemComponent::OnThresholdAttributeChanged);
 		}
 	}
 
-	return false;
+	FPOTAttributeThresholdWatch& Watch = AttributeThresholdWatches.AddDefaulted_GetRef();
+	Watch.Handle = ++LastAttributeThresholdHandle;
+	Watch.Owner = Owner;
+	Watch.ValueAttribute = ValueAttribute;
+	Watch.MaxAttribute = MaxAttribute;
+	Watch.Threshold = Threshold;
+	Watch.Hysteresis = FMath::Max(Hysteresis, 0.f);
+	Watch.Direction = Direction;
+	Watch.bRequirePositiveMax = bRequirePositiveMax;
+	Watch.OnCrossed = MoveTemp(OnCrossed);
+
+	EvaluateAttributeThreshold(Watch);
+
+	return Watch.Handle;
 }
 
-bool UPOTAbilitySystemComponent::HasAbilityVerticalControlInWater() const
+void UPOTAbilitySystemComponent::RemoveAttributeThresholdWatch(int32 Handle)
 {
-	if (CurrentAttackAbility && CurrentAttackAbility->bAllowVerticalControlInWater)
+	if (Handle == INDEX_NONE)
 	{
-		return true;
+		return;
 	}
 
-	for (int Index = NonExclusiveAbilities.Num() - 1; Index >= 0; Index--)
+	AttributeThresholdWatches.RemoveAllSwap([Handle](const FPOTAttributeThresholdWatch& Watch) { return Watch.Handle == Handle; });
+}
+
+const FPOTAttributeThresholdWatch* UPOTAbilitySystemComponent::FindAttributeThresholdWatch(int32 Handle) const
+{
+	return AttributeThresholdWatches.FindByPredicate([Handle](const FPOTAttributeThresholdWatch& Watch) { return Watch.Handle == Handle; });
+}
+
+const FPOTAttributeThresholdWatch* UPOTAbilitySystemComponent::FindAttributeThresholdWatchByOwner(const UObject* Owner) const
+{
+	return AttributeThresholdWatches.FindByPredicate([Owner](const FPOTAttributeThresholdWatch& Watch) { return Watch.Owner.Get() == Owner; });
+}
+
+float UPOTAbilitySystemComponent::GetAttributeThresholdRatio(float Value, float MaxValue)
+{
+	return (Value > 0.f && MaxValue > 0.f) ? Value / MaxValue : 0.f;
+}
+
+bool UPOTAbilitySystemComponent::EvaluateAttributeThreshold(FPOTAttributeThresholdWatch& Watch) const
+{
+	const bool bWasPassed = Watch.bPassed;
+	const float MaxValue = GetNumericAttribute(Watch.MaxAttribute);
+
+	if (Watch.bRequirePositiveMax && MaxValue <= 0.f)
 	{
-		UPOTGameplayAbility* Ability = NonExclusiveAbilities[Index];
-		if (ensure(Ability))
+		Watch.bPassed = false;
+		Watch.bAtThreshold = false;
+		return false;
+	}
+
+	const float Ratio = GetAttributeThresholdRatio(GetNumericAttribute(Watch.ValueAttribute), MaxValue);
+
+	if (Watch.Direction == EPOTAttributeThresholdDirection::Rising)
+	{
+		Watch.bAtThreshold = Ratio >= Watch.Threshold;
+		Watch.bPassed = Watch.bAtThreshold || (bWasPassed && Ratio >= Watch.Threshold - Watch.Hysteresis);
+	}
+	else
+	{
+		Watch.bAtThreshold = Ratio <= Watch.Threshold;
+		Watch.bPassed = Watch.bAtThreshold || (bWasPassed && Ratio <= Watch.Threshold + Watch.Hysteresis);
+	}
+
+	return !bWasPassed && Watch.bPassed;
+}
+
+void UPOTAbilitySystemComponent::OnThresholdAttributeChanged(const FOnAttributeChangeData& ChangeData)
+{
+	// Callbacks may add or remove watches, so they only run once every affected watch has been evaluated
+	TArray<FPOTAttributeThresholdCrossed, TInlineAllocator<4>> CrossedCallbacks;
+
+	for (int32 Index = AttributeThresholdWatches.Num() - 1; Index >= 0; --Index)
+	{
+		FPOTAttributeThresholdWatch& Watch = AttributeThresholdWatches[Index];
+		if (Watch.ValueAttribute != ChangeData.Attribute && Watch.MaxAttribute != ChangeData.Attribute)
 		{
-			if (Ability->bAllowVerticalControlInWater)
-			{
-				return true;
-			}
+			continue;
+		}
+
+		if (!Watch.Owner.IsValid())
+		{
+			AttributeThresholdWatches.RemoveAtSwap(Index);
+			continue;
+		}
+
+		if (EvaluateAttributeThreshold(Watch))
+		{
+			CrossedCallbacks.Add(Watch.OnCrossed);
 		}
 	}
 
-	return false;
+	for (const FPOTAttributeThresholdCrossed& Callback : CrossedCallbacks)
+	{
+		Callback.ExecuteIfBound();
+	}
+}
+
+float UPOTAbilitySystemComponent::GetAbilityForcedMovementSpeed() const
+{
+	float MaxSpeed = 0;
+
+	for (const TWeakObjectPtr<UPOTGameplayAbility>& Ability : MovementOverrides.SpeedOverrideAbilities)
+	{
+		if (Ability.IsValid())
+		{
+			MaxSpeed = FMath::Max(MaxSpeed, Ability->GetMaxMovementMultiplierSpeed());
+		}
+	}
+
+	return MaxSpeed;
+}
+
+bool UPOTAbilitySystemComponent::HasAbilityForcedMovementSpeed() const
+{
+	return MovementOverrides.bForcedMovementSpeed;
+}
+
+bool UPOTAbilitySystemComponent::HasAbilityVerticalControlInWater() const
+{
+	return MovementOverrides.bVerticalControlInWater;
 }
 
 void UPOTAbilitySystemComponent::FinishAbilityWithMontage(UAnimMontage* Montage)
@@ -1929,7 +2083,7 @@ void UPOTAbilitySystemComponent::Server_HitWallEvent_Implementation(const FHitRe
 	}
 }
 
-TArray<FPOTGameplayAbilityRepAnimMontage>& UPOTAbilitySystemComponent::GetAbilityMontages_Mutable()
+FPOTAbilityMontageArray& UPOTAbilitySystemComponent::GetAbilityMontages_Mutable()
 {
 	MARK_PROPERTY_DIRTY_FROM_NAME(UPOTAbilitySystemComponent, AbilityMontages, this);
 	return AbilityMontages;
@@ -1937,73 +2091,29 @@ TArray<FPOTGameplayAbilityRepAnimMontage>& UPOTAbilitySystemComponent::GetAbilit
 
 bool UPOTAbilitySystemComponent::HasAbilityForcedRotation() const
 {
-	if (CurrentAttackAbility)
+	for (const TWeakObjectPtr<UPOTGameplayAbility>& Ability : MovementOverrides.RotationAbilities)
 	{
-		if (CurrentAttackAbility->HasForcedMovementRotation())
+		if (Ability.IsValid() && Ability->HasForcedMovementRotation())
 		{
 			return true;
 		}
 	}
 
-	for (int Index = NonExclusiveAbilities.Num() - 1; Index >= 0; Index--)
-	{
-		UPOTGameplayAbility* Ability = NonExclusiveAbilities[Index];
-		if (ensure(Ability))
-		{
-			if (Ability->HasForcedMovementRotation())
-			{
-				return true;
-			}
-		}
-	}
-
 	return false;
 }
 
 bool UPOTAbilitySystemComponent::OverrideMovementImmersionDepth() const
 {
-	if (CurrentAttackAbility)
-	{
-		if (CurrentAttackAbility->bOverrideMovementImmersionDepth)
-		{
-			return true;
-		}
-	}
-
-	for (int Index = NonExclusiveAbilities.Num() - 1; Index >= 0; Index--)
-	{
-		UPOTGameplayAbility* Ability = NonExclusiveAbilities[Index];
-		if (ensure(Ability))
-		{
-			if (Ability->bOverrideMovementImmersionDepth)
-			{
-				return true;
-			}
-		}
-	}
-
-	return false;
+	return MovementOverrides.bOverrideImmersionDepth;
 }
 
 FRotator UPOTAbilitySystemComponent::GetAbilityForcedRotation() const
 {
-	if (CurrentAttackAbility)
+	for (const TWeakObjectPtr<UPOTGameplayAbility>& Ability : MovementOverrides.RotationAbilities)
 	{
-		if (CurrentAttackAbility->HasForcedMovementRotation())
+		if (Ability.IsValid() && Ability->HasForcedMovementRotation())
 		{
-			return CurrentAttackAbility->GetForcedMovementRotation();
-		}
-	}
-
-	for (int Index = NonExclusiveAbilities.Num() - 1; Index >= 0; Index--)
-	{
-		UPOTGameplayAbility* Ability = NonExclusiveAbilities[Index];
-		if (ensure(Ability))
-		{
-			if (Ability->HasForcedMovementRotation())
-			{
-				return Ability->GetForcedMovementRotation();
-			}
+			return Ability->GetForcedMovementRotation();
 		}
 	}
 
@@ -2047,18 +2157,53 @@ void UPOTAbilitySystemComponent::CancelAbilityByClass(TSubclassOf<UGameplayAbili
 	}
 }
 
-FPOTGameplayAbilityRepAnimMontage FPOTGameplayAbilityRepAnimMontage::Generate()
+void FPOTAbilityMontageItem::PreReplicatedRemove(const FPOTAbilityMontageArray& InArraySerializer)
 {
-	FPOTGameplayAbilityRepAnimMontage Montage = FPOTGameplayAbilityRepAnimMontage();
+	if (InArraySerializer.Owner)
+	{
+		InArraySerializer.Owner->OnReplicatedAbilityMontageRemoved(*this);
+	}
+}
 
-	static uint32 Unique = 0;
-	Montage.UniqueId = Unique++;
+void FPOTAbilityMontageItem::PostReplicatedAdd(const FPOTAbilityMontageArray& InArraySerializer)
+{
+	if (InArraySerializer.Owner)
+	{
+		InArraySerializer.Owner->OnReplicatedAbilityMontageChanged(*this);
+	}
+}
 
-	return Montage;
+void FPOTAbilityMontageItem::PostReplicatedChange(const FPOTAbilityMontageArray& InArraySerializer)
+{
+	if (InArraySerializer.Owner)
+	{
+		InArraySerializer.Owner->OnReplicatedAbilityMontageChanged(*this);
+	}
 }
 
-bool FPOTGameplayAbilityRepAnimMontage::NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess)
+bool FPOTAbilityMontageItem::NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess)
 {
-	Ar.SerializeIntPacked(UniqueId);
-	return InnerMontage.NetSerialize(Ar, Map, bOutSuccess);
+	Ar << AnimMontage;
+
+	// Play rate in 1/256 steps, position in milliseconds
+	int16 QuantizedPlayRate = 0;
+	uint32 QuantizedPosition = 0;
+	if (Ar.IsSaving())
+	{
+		QuantizedPlayRate = static_cast<int16>(FMath::Clamp(FMath::RoundToInt(PlayRate * 256.f), (int32)MIN_int16, (int32)MAX_int16));
+		QuantizedPosition = static_cast<uint32>(FMath::RoundToInt(FMath::Max(Position, 0.f) * 1000.f));
+	}
+
+	Ar << QuantizedPlayRate;
+	Ar.SerializeIntPacked(QuantizedPosition);
+	Ar << PositionTime;
+
+	if (Ar.IsLoading())
+	{
+		PlayRate = QuantizedPlayRate / 256.f;
+		Position = QuantizedPosition / 1000.f;
+	}
+
+	bOutSuccess = true;
+	return true;
 }
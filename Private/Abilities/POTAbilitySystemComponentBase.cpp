@@ -29,6 +29,27 @@
 
 #define GROWTH_IMPEDIMENT_CHECK_INTERVAL 1.f
 
+DECLARE_CYCLE_STAT(TEXT("Save Active Gameplay Effects"), STAT_SaveActiveGameplayEffects, STATGROUP_Game);
+DECLARE_CYCLE_STAT(TEXT("Apply Saved Gameplay Effect"), STAT_ApplySavedGameplayEffect, STATGROUP_Game);
+DECLARE_CYCLE_STAT(TEXT("Check Growth Inhibition"), STAT_CheckGrowthInhibition, STATGROUP_Game);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Growth Clearance Overlaps"), STAT_GrowthClearanceOverlaps, STATGROUP_Game);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Growth Clearance Cache Hits"), STAT_GrowthClearanceCacheHits, STATGROUP_Game);
+
+namespace POTAbilitySystemCVars
+{
+	static TAutoConsoleVariable<float> CVarGrowthClearanceCacheTime(
+		TEXT("pot.GrowthClearanceCacheTime"),
+		3.f,
+		TEXT("Seconds a growth clearance result is reused while the character has not moved or changed size. 0 disables the cache.\n"),
+		ECVF_Default);
+
+	static TAutoConsoleVariable<bool> CVarDebugGrowthInhibition(
+		TEXT("pot.DebugGrowthInhibition"),
+		false,
+		TEXT("If true, draw growth clearance capsules and log the actors blocking growth.\n"),
+		ECVF_Cheat);
+}
+
 UPOTAbilitySystemComponentBase::UPOTAbilitySystemComponentBase()
 	: bInitialized(false)
 	, bForceDeflectOnInstigator(true)
@@ -167,9 +188,19 @@ void UPOTAbilitySystemComponentBase::InitAttributes(bool bInitialInit /*= true*/
 			FName AttributeName = GetAttributeName();
 			FPOTAttributeSetInitter* PASI = static_cast<FPOTAttributeSetInitter*>(ASI);
 
-			PASI->InitAttributeSetDefaultsGradient(this,
-				AttributeName,
-				GetLevelFloat(), bInitialInit);
+			if (!bInitialInit && bAttributesLoaded && LoadedAttributeGroupName == AttributeName && LoadedAttributeDefaultsVersion == PASI->GetDefaultsVersion())
+			{
+				PASI->UpdateAttributeSetDefaultsGradient(this, AttributeName, GetLevelFloat());
+			}
+			else
+			{
+				PASI->InitAttributeSetDefaultsGradient(this,
+					AttributeName,
+					GetLevelFloat(), bInitialInit);
+
+				LoadedAttributeGroupName = AttributeName;
+				LoadedAttributeDefaultsVersion = PASI->GetDefaultsVersion();
+			}
 
 			/*else
 			{
@@ -330,37 +361,27 @@ float UPOTAbilitySystemComponentBase::GetCooldownTimeRemaining(const TSubclassOf
 		//return GADefault->GetCooldownTimeRemaining(&ActorInfo);
 
 		const FGameplayTagContainer* CooldownTags = GADefault->GetCooldownTags();
-		if (CooldownTags && CooldownTags->Num() > 0)
+		if (CooldownTags && CooldownTags->Num() > 0 && CooldownTagExpiry.Num() > 0)
 		{
-			FGameplayEffectQuery const Query = FGameplayEffectQuery::MakeQuery_MatchAnyOwningTags(*CooldownTags);
-			float CurrentTime = GetWorld()->GetTimeSeconds();
-
-			TArray< float > Durations;
-			for (const FActiveGameplayEffect& ActiveCooldownEffect : CurrentCooldownEffects)
-			{
-				if (!ActiveCooldownEffect.Spec.Def) continue;
-				if (CooldownTags->HasAny(ActiveCooldownEffect.Spec.Def.Get()->GetGrantedTags()))
-				{					
-					Durations.Add(ActiveCooldownEffect.GetTimeRemaining(CurrentTime));
-				}
-			}
+			bool bFoundCooldown = false;
+			float LatestExpiry = 0.f;
 
-			FTimerManager& TimerManager = GetWorld()->GetTimerManager();
-
-			for (TPair<const UGameplayEffect*, FTimerHandle> Pair : CurrentCooldownDelays)
+			// A granted tag matches when it is the cooldown tag itself or one of its parents
+			for (const FGameplayTag& CooldownTag : *CooldownTags)
 			{
-				if (!Pair.Key) continue;
-				if (CooldownTags->HasAny(Pair.Key->GetGrantedTags()))
+				for (FGameplayTag Tag = CooldownTag; Tag.IsValid(); Tag = Tag.RequestDirectParent())
 				{
-					Durations.Add(TimerManager.GetTimerRemaining(Pair.Value));
+					if (const float* Expiry = CooldownTagExpiry.Find(Tag))
+					{
+						LatestExpiry = bFoundCooldown ? FMath::Max(LatestExpiry, *Expiry) : *Expiry;
+						bFoundCooldown = true;
+					}
 				}
 			}
 
-			//TArray< float > Durations = GetActiveEffectsTimeRemaining(Query);
-			if (Durations.Num() > 0)
+			if (bFoundCooldown)
 			{
-				Durations.Sort();
-				return Durations[Durations.Num() - 1];
+				return LatestExpiry - GetWorld()->GetTimeSeconds();
 			}
 		}
 	}
@@ -398,25 +419,37 @@ bool UPOTAbilitySystemComponentBase::CanActivateAbility(const TSubclassOf<UGamep
 float UPOTAbilitySystemComponentBase::GetTotalHealthBleed(const bool bRatio /*= false*/) const
 {
 	// @TODO: New Status might impact this logic. Should make it more dynamic.
-	float BleedRate = GetNumericAttribute(UCoreAttributeSet::GetBleedingRateAttribute());
-	if (BleedRate == 0.f)
+	return GetProjectedStatusDamage(UCoreAttributeSet::GetBleedingRateAttribute(), UCoreAttributeSet::GetBleedingHealRateAttribute(), bRatio);
+}
+
+float UPOTAbilitySystemComponentBase::GetTotalHealthPoison(const bool bRatio /*= false*/) const
+{
+	return GetProjectedStatusDamage(UCoreAttributeSet::GetPoisonRateAttribute(), UCoreAttributeSet::GetPoisonHealRateAttribute(), bRatio);
+}
+
+float UPOTAbilitySystemComponentBase::GetTotalHealthVenom(const bool bRatio /*= false*/) const
+{
+	return GetProjectedStatusDamage(UCoreAttributeSet::GetVenomRateAttribute(), UCoreAttributeSet::GetVenomHealRateAttribute(), bRatio);
+}
+
+float UPOTAbilitySystemComponentBase::GetProjectedStatusDamage(const FGameplayAttribute& RateAttribute, const FGameplayAttribute& HealRateAttribute, const bool bRatio) const
+{
+	const float Rate = GetNumericAttribute(RateAttribute);
+	if (Rate <= 0.f)
 	{
 		return 0.f;
 	}
 
-	const float BleedHealRate = GetNumericAttribute(UCoreAttributeSet::GetBleedingHealRateAttribute());
+	const float HealRate = GetNumericAttribute(HealRateAttribute);
 
-	if (BleedHealRate <= 0.f)
+	if (HealRate <= 0.f)
 	{
 		return bRatio ? 1.f : GetNumericAttribute(UCoreAttributeSet::GetHealthAttribute());
 	}
-	
-	float DamageTotal = 0.f;
-	while (BleedRate > 0.f)
-	{
-		DamageTotal += BleedRate;
-		BleedRate -= BleedHealRate;
-	}
+
+	// The status deals Rate, Rate - HealRate, Rate - 2 * HealRate... while positive, sum the series directly
+	const float Ticks = FMath::CeilToFloat(Rate / HealRate);
+	const float DamageTotal = Ticks * Rate - HealRate * Ticks * (Ticks - 1.f) * 0.5f;
 
 	if (bRatio)
 	{
@@ -427,6 +460,73 @@ float UPOTAbilitySystemComponentBase::GetTotalHealthBleed(const bool bRatio /*=
 	return DamageTotal;
 }
 
+int32 UPOTAbilitySystemComponentBase::GetStatusTicksToClear(const FGameplayAttribute& RateAttribute, const FGameplayAttribute& HealRateAttribute) const
+{
+	const float Rate = GetNumericAttribute(RateAttribute);
+	if (Rate <= 0.f)
+	{
+		return 0;
+	}
+
+	const float HealRate = GetNumericAttribute(HealRateAttribute);
+	if (HealRate <= 0.f)
+	{
+		return INDEX_NONE;
+	}
+
+	return FMath::CeilToInt(Rate / HealRate);
+}
+
+int32 UPOTAbilitySystemComponentBase::GetStatusTicksToDeath(const FGameplayAttribute& RateAttribute, const FGameplayAttribute& HealRateAttribute) const
+{
+	const float Rate = GetNumericAttribute(RateAttribute);
+	if (Rate <= 0.f)
+	{
+		return INDEX_NONE;
+	}
+
+	const float Health = GetNumericAttribute(UCoreAttributeSet::GetHealthAttribute());
+	if (Health <= 0.f)
+	{
+		return 0;
+	}
+
+	const float HealRate = GetNumericAttribute(HealRateAttribute);
+	if (HealRate <= 0.f)
+	{
+		return FMath::CeilToInt(Health / Rate);
+	}
+
+	// Damage dealt after K ticks is K * Rate - HealRate * K * (K - 1) / 2, find the first K where it reaches Health
+	auto DamageAfterTicks = [Rate, HealRate](const int32 NumTicks)
+	{
+		return NumTicks * Rate - HealRate * NumTicks * (NumTicks - 1) * 0.5f;
+	};
+
+	const int32 TicksToClear = FMath::CeilToInt(Rate / HealRate);
+	if (DamageAfterTicks(TicksToClear) < Health)
+	{
+		return INDEX_NONE;
+	}
+
+	// Smaller root of HealRate / 2 * K^2 - (Rate + HealRate / 2) * K + Health = 0
+	const float B = Rate + HealRate * 0.5f;
+	const float Discriminant = FMath::Max(B * B - 2.f * HealRate * Health, 0.f);
+	int32 TicksToDeath = FMath::Clamp(FMath::CeilToInt((B - FMath::Sqrt(Discriminant)) / HealRate), 1, TicksToClear);
+
+	// Correct for float error around the root
+	while (TicksToDeath > 1 && DamageAfterTicks(TicksToDeath - 1) >= Health)
+	{
+		TicksToDeath--;
+	}
+	while (TicksToDeath < TicksToClear && DamageAfterTicks(TicksToDeath) < Health)
+	{
+		TicksToDeath++;
+	}
+
+	return TicksToDeath;
+}
+
 float UPOTAbilitySystemComponentBase::GetTotalStaminaDrain(const bool bRatio /*= false*/) const
 {
 	return 0.f;
@@ -477,6 +577,96 @@ void UPOTAbilitySystemComponentBase::ModifyActiveGameplayEffectDurationByHandle(
 	}
 }
 
+void UPOTAbilitySystemComponentBase::SaveActiveGameplayEffects(TArray<FSavedGameplayEffectData>& OutSavedEffects) const
+{
+	SCOPE_CYCLE_COUNTER(STAT_SaveActiveGameplayEffects);
+
+	OutSavedEffects.Reset();
+
+	const UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	const float WorldTime = World->GetTimeSeconds();
+	const FTimerManager& WTM = World->GetTimerManager();
+
+	OutSavedEffects.Reserve(ActiveGameplayEffects.GetNumGameplayEffects());
+
+	for (auto It = ActiveGameplayEffects.CreateConstIterator(); It; ++It)
+	{
+		const FActiveGameplayEffect& ActiveEffect = *It;
+		if (!ActiveEffect.Spec.Def)
+		{
+			continue;
+		}
+
+		const float RemainingTime = ActiveEffect.GetTimeRemaining(WorldTime);
+		if (RemainingTime <= 0.f)
+		{
+			continue;
+		}
+
+		FSavedGameplayEffectData& SavedEffect = OutSavedEffects.Emplace_GetRef(ActiveEffect.Spec.Def, RemainingTime);
+		SavedEffect.Version = FSavedGameplayEffectData::CurrentVersion;
+		SavedEffect.Level = ActiveEffect.Spec.GetLevel();
+		SavedEffect.StackCount = ActiveEffect.Spec.GetStackCount();
+		SavedEffect.SetByCallerMagnitudes = ActiveEffect.Spec.SetByCallerTagMagnitudes;
+
+		if (ActiveEffect.PeriodHandle.IsValid())
+		{
+			SavedEffect.PeriodRemaining = FMath::Max(WTM.GetTimerRemaining(ActiveEffect.PeriodHandle), 0.f);
+		}
+	}
+}
+
+FActiveGameplayEffectHandle UPOTAbilitySystemComponentBase::ApplySavedGameplayEffect(const FSavedGameplayEffectData& SavedEffect)
+{
+	SCOPE_CYCLE_COUNTER(STAT_ApplySavedGameplayEffect);
+
+	if (!SavedEffect.Effect || SavedEffect.Duration <= 0.f)
+	{
+		return FActiveGameplayEffectHandle();
+	}
+
+	const bool bHasSpecState = SavedEffect.Version >= 1;
+
+	FGameplayEffectSpec Spec(SavedEffect.Effect, MakeEffectContext(), bHasSpecState ? SavedEffect.Level : 1.f);
+
+	if (bHasSpecState)
+	{
+		for (const TPair<FGameplayTag, float>& SetByCaller : SavedEffect.SetByCallerMagnitudes)
+		{
+			Spec.SetSetByCallerMagnitude(SetByCaller.Key, SetByCaller.Value);
+		}
+
+		Spec.SetStackCount(FMath::Max(SavedEffect.StackCount, 1));
+	}
+
+	// Lock the remaining duration into the spec so the effect doesn't need adjusting after it is applied
+	Spec.SetDuration(SavedEffect.Duration, true);
+
+	const FActiveGameplayEffectHandle ActiveEffectHandle = ApplyGameplayEffectSpecToSelf(Spec);
+
+	if (!ActiveEffectHandle.IsValid() || !bHasSpecState || SavedEffect.PeriodRemaining <= 0.f)
+	{
+		return ActiveEffectHandle;
+	}
+
+	// Resume the periodic timer where it left off rather than restarting the full period
+	FActiveGameplayEffect* ActiveEffect = ActiveGameplayEffects.GetActiveGameplayEffect(ActiveEffectHandle);
+	UWorld* World = GetWorld();
+	if (ActiveEffect && World && ActiveEffect->PeriodHandle.IsValid())
+	{
+		const float Period = ActiveEffect->Spec.GetPeriod();
+		FTimerDelegate Delegate = FTimerDelegate::CreateUObject(this, &UPOTAbilitySystemComponentBase::ExecutePeriodicEffect, ActiveEffectHandle);
+		World->GetTimerManager().SetTimer(ActiveEffect->PeriodHandle, Delegate, Period, true, FMath::Min(SavedEffect.PeriodRemaining, Period));
+	}
+
+	return ActiveEffectHandle;
+}
+
 void UPOTAbilitySystemComponentBase::ApplySoftClassPtrEffects(const TArray<TSoftClassPtr<UGameplayEffect>>& Effects)
 {
 	FStreamableManager& Streamable = UIGameplayStatics::GetStreamableManager(this);
@@ -862,7 +1052,8 @@ void UPOTAbilitySystemComponentBase::PotentiallyStartGrowthInhibitionCheck()
 		return;
 	}
 
-	World->GetTimerManager().SetTimer(GrowthInhibitionTimerHandle, this, &UPOTAbilitySystemComponentBase::OnInhibitionTimer, GROWTH_IMPEDIMENT_CHECK_INTERVAL, true);
+	// Randomize the first delay so characters that start growing together don't all test on the same frame
+	World->GetTimerManager().SetTimer(GrowthInhibitionTimerHandle, this, &UPOTAbilitySystemComponentBase::OnInhibitionTimer, GROWTH_IMPEDIMENT_CHECK_INTERVAL, true, FMath::FRandRange(0.f, GROWTH_IMPEDIMENT_CHECK_INTERVAL));
 	CheckGrowthInhibition(true);
 }
 
@@ -889,6 +1080,8 @@ void UPOTAbilitySystemComponentBase::OnInhibitionTimer()
 
 void UPOTAbilitySystemComponentBase::CheckGrowthInhibition(bool bInitialTest /*= false*/)
 {
+	SCOPE_CYCLE_COUNTER(STAT_CheckGrowthInhibition);
+
 	UWorld* World = GetWorld();
 	if (World == nullptr)
 	{
@@ -926,8 +1119,8 @@ void UPOTAbilitySystemComponentBase::CheckGrowthInhibition(bool bInitialTest /*=
 	}
 
 
-	static FGameplayEffectQuery Query = Query.MakeQuery_MatchAllOwningTags(FGameplayTagContainer(FGameplayTag::RequestGameplayTag(NAME_DebuffGrowthDisabled)));
-	if(GetActiveEffects(Query).Num() > 0 && !GrowthInhibitionHandle.IsValid())
+	static const FGameplayTag GrowthDisabledTag = FGameplayTag::RequestGameplayTag(NAME_DebuffGrowthDisabled);
+	if(HasMatchingGameplayTag(GrowthDisabledTag) && !GrowthInhibitionHandle.IsValid())
 	{
 		bGrowthInhibited = true;
 		if (!bInitialTest)
@@ -946,37 +1139,67 @@ void UPOTAbilitySystemComponentBase::CheckGrowthInhibition(bool bInitialTest /*=
 		return;
 	}
 
-	float Inflation = CapsuleComp->GetScaledCapsuleRadius() * GrowthInflationRatio;
+	const float CapsuleRadius = CapsuleComp->GetScaledCapsuleRadius();
+	const float CapsuleHalfHeight = CapsuleComp->GetScaledCapsuleHalfHeight();
+	const float Inflation = CapsuleRadius * GrowthInflationRatio;
+
+	FVector TestLocation = OwnerChar->GetActorLocation();
+	TestLocation.Z += (CapsuleHalfHeight * GrowthInflationRatio);
+
+	const bool bDebugGrowthInhibition = POTAbilitySystemCVars::CVarDebugGrowthInhibition.GetValueOnGameThread();
+	const float ClearanceCacheTime = POTAbilitySystemCVars::CVarGrowthClearanceCacheTime.GetValueOnGameThread();
+	const float CurrentTime = World->GetTimeSeconds();
+
+	// Characters sitting still at the same size will get the same answer, skip the overlap until the cache goes stale
+	if (!bInitialTest && !bDebugGrowthInhibition && ClearanceCacheTime > 0.f && LastGrowthClearanceTime >= 0.f
+		&& CurrentTime - LastGrowthClearanceTime < ClearanceCacheTime
+		&& FVector::DistSquared(TestLocation, LastGrowthClearanceLocation) < FMath::Square(10.f)
+		&& FMath::IsNearlyEqual(CapsuleRadius, LastGrowthClearanceRadius, 1.f)
+		&& FMath::IsNearlyEqual(CapsuleHalfHeight, LastGrowthClearanceHalfHeight, 1.f))
+	{
+		INC_DWORD_STAT(STAT_GrowthClearanceCacheHits);
+
+		bGrowthInhibited = bLastGrowthClearanceBlocked;
+		if (bGrowthInhibited)
+		{
+			BlockGrowth();
+		}
+		else
+		{
+			UnblockGrowth();
+		}
+		return;
+	}
 
-	bool bFoundBlockingHit = false;
-	TArray<FOverlapResult> Overlaps;
 	ECollisionChannel const BlockingChannel = CapsuleComp->GetCollisionObjectType();
 	FCollisionShape const CollisionShape = CapsuleComp->GetCollisionShape(Inflation);
-
-	FVector TestLocation = OwnerChar->GetActorLocation();
-	TestLocation.Z += (CapsuleComp->GetScaledCapsuleHalfHeight() * GrowthInflationRatio);
 	
 	FCollisionQueryParams Params(SCENE_QUERY_STAT(CheckGrowthInhibition), false, OwnerChar);
 	FCollisionResponseParams ResponseParams;
 	CapsuleComp->InitSweepCollisionParams(Params, ResponseParams);
 
-	TArray<AActor*> IgnoreActors { OwnerChar };
+	Params.AddIgnoredActor(OwnerChar);
 	if(UCharacterMovementComponent* CMC = OwnerChar->GetCharacterMovement())
 	{
 		if(CMC->GetMovementBase() != nullptr)
 		{
-			IgnoreActors.Add(CMC->GetMovementBase()->GetOwner());
+			Params.AddIgnoredActor(CMC->GetMovementBase()->GetOwner());
 		}
 	}
 
-	Params.AddIgnoredActors(IgnoreActors);
-	bFoundBlockingHit = World->OverlapMultiByChannel(Overlaps, TestLocation, OwnerChar->GetActorRotation().Quaternion(), BlockingChannel, CollisionShape, Params, ResponseParams);
-	
-	if (bFoundBlockingHit)
+	INC_DWORD_STAT(STAT_GrowthClearanceOverlaps);
+
+	bool bFoundBlockingHit = false;
+	const FQuat TestRotation = OwnerChar->GetActorRotation().Quaternion();
+
+	if (bDebugGrowthInhibition)
 	{
+		TArray<FOverlapResult> Overlaps;
+		bFoundBlockingHit = World->OverlapMultiByChannel(Overlaps, TestLocation, TestRotation, BlockingChannel, CollisionShape, Params, ResponseParams);
+
 		DrawDebugCapsule(World, TestLocation, CollisionShape.GetCapsuleHalfHeight(), CollisionShape.GetCapsuleRadius(),
-			OwnerChar->GetActorRotation().Quaternion(), bFoundBlockingHit ? FColor::Red : FColor::Green, GROWTH_IMPEDIMENT_CHECK_INTERVAL, 0, 5.f);
-		
+			TestRotation, bFoundBlockingHit ? FColor::Red : FColor::Green, GROWTH_IMPEDIMENT_CHECK_INTERVAL, 0, 5.f);
+
 #if !UE_BUILD_SHIPPING
 		for (const FOverlapResult& Result : Overlaps)
 		{
@@ -987,7 +1210,16 @@ void UPOTAbilitySystemComponentBase::CheckGrowthInhibition(bool bInitialTest /*=
 		}
 #endif
 	}
-	
+	else
+	{
+		bFoundBlockingHit = World->OverlapBlockingTestByChannel(TestLocation, TestRotation, BlockingChannel, CollisionShape, Params, ResponseParams);
+	}
+
+	LastGrowthClearanceLocation = TestLocation;
+	LastGrowthClearanceRadius = CapsuleRadius;
+	LastGrowthClearanceHalfHeight = CapsuleHalfHeight;
+	LastGrowthClearanceTime = CurrentTime;
+	bLastGrowthClearanceBlocked = bFoundBlockingHit;
 
 	bGrowthInhibited = bFoundBlockingHit;
 	if(bGrowthInhibited && !bInitialTest)
@@ -1046,6 +1278,7 @@ void UPOTAbilitySystemComponentBase::AddNewCooldownEffect(FActiveGameplayEffectH
 	FActiveGameplayEffect CooldownEffect = *ActiveEffectPtr;
 
 	CurrentCooldownEffects.Add(CooldownEffect);
+	RebuildCooldownTagIndex();
 
 	float CurrentTime = GetWorld()->GetTimeSeconds();
 
@@ -1068,6 +1301,43 @@ const TArray<TPair<const UGameplayEffect*, FTimerHandle>>& UPOTAbilitySystemComp
 void UPOTAbilitySystemComponentBase::ExpireOldCooldownEffect(FActiveGameplayEffect Effect)
 {
 	CurrentCooldownEffects.Remove(Effect);
+	RebuildCooldownTagIndex();
+}
+
+void UPOTAbilitySystemComponentBase::RebuildCooldownTagIndex()
+{
+	CooldownTagExpiry.Reset();
+
+	const UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	const float CurrentTime = World->GetTimeSeconds();
+
+	auto AddExpiry = [this](const FGameplayTagContainer& GrantedTags, float ExpiryTime)
+	{
+		for (const FGameplayTag& GrantedTag : GrantedTags)
+		{
+			float& LatestExpiry = CooldownTagExpiry.FindOrAdd(GrantedTag, ExpiryTime);
+			LatestExpiry = FMath::Max(LatestExpiry, ExpiryTime);
+		}
+	};
+
+	for (const FActiveGameplayEffect& ActiveCooldownEffect : CurrentCooldownEffects)
+	{
+		if (!ActiveCooldownEffect.Spec.Def) continue;
+		AddExpiry(ActiveCooldownEffect.Spec.Def->GetGrantedTags(), CurrentTime + ActiveCooldownEffect.GetTimeRemaining(CurrentTime));
+	}
+
+	const FTimerManager& TimerManager = World->GetTimerManager();
+
+	for (const TPair<const UGameplayEffect*, FTimerHandle>& Pair : CurrentCooldownDelays)
+	{
+		if (!Pair.Key) continue;
+		AddExpiry(Pair.Key->GetGrantedTags(), CurrentTime + TimerManager.GetTimerRemaining(Pair.Value));
+	}
 }
 
 void UPOTAbilitySystemComponentBase::NotifyTimeOfDay(float InTime)
@@ -1112,6 +1382,7 @@ void UPOTAbilitySystemComponentBase::RemoveAllCooldowns()
 	}
 	CurrentCooldownEffects.Empty();
 	CurrentCooldownDelays.Empty();
+	CooldownTagExpiry.Reset();
 	Client_RemoveAllCooldowns();
 }
 
@@ -1339,6 +1610,7 @@ void UPOTAbilitySystemComponentBase::Client_RemoveAllCooldowns_Implementation()
 {
 	CurrentCooldownEffects.Empty();
 	CurrentCooldownDelays.Empty();
+	CooldownTagExpiry.Reset();
 }
 
 void UPOTAbilitySystemComponentBase::Client_OnAbilityDelayed_Implementation(FGameplayAbilitySpecHandle Handle, float DelayAmount)
@@ -1363,12 +1635,7 @@ void UPOTAbilitySystemComponentBase::Client_OnAbilityDelayed_Implementation(FGam
 	if (const UGameplayEffect* Effect = AbilityToActivate->GetCooldownGameplayEffect())
 	{
 		float RemainingTime = GetCooldownTimeRemaining(AbilityToActivate->GetClass());
-
-		FTimerHandle NewCooldownDelayHandle;
-		FTimerDelegate Del = FTimerDelegate::CreateUObject(this, &UPOTAbilitySystemComponentBase::ClearDelayedCooldown, Effect);
-		GetWorld()->GetTimerManager().SetTimer(NewCooldownDelayHandle, Del, RemainingTime + DelayAmount, false);
-
-		CurrentCooldownDelays.Add({ Effect, NewCooldownDelayHandle });
+		AddCooldownDelay(Effect, RemainingTime + DelayAmount);
 	}	
 }
 
@@ -1393,11 +1660,7 @@ void UPOTAbilitySystemComponentBase::Client_OnRestoreCooldown_Implementation(FGa
 
 	if (const UGameplayEffect* Effect = AbilityToActivate->GetCooldownGameplayEffect())
 	{
-		FTimerHandle NewCooldownDelayHandle;
-		FTimerDelegate Del = FTimerDelegate::CreateUObject(this, &UPOTAbilitySystemComponentBase::ClearDelayedCooldown, Effect);
-		GetWorld()->GetTimerManager().SetTimer(NewCooldownDelayHandle, Del, CooldownAmount, false);
-
-		CurrentCooldownDelays.Add({ Effect, NewCooldownDelayHandle });
+		AddCooldownDelay(Effect, CooldownAmount);
 	}
 }
 
@@ -1414,6 +1677,7 @@ void UPOTAbilitySystemComponentBase::ClearDelayedCooldown(const UGameplayEffect*
 		if (CurrentCooldownDelays[Index].Key == Cooldown)
 		{
 			CurrentCooldownDelays.RemoveAt(Index);
+			RebuildCooldownTagIndex();
 			return;
 		}
 	}
@@ -1433,6 +1697,7 @@ void UPOTAbilitySystemComponentBase::AddCooldownDelay(const UGameplayEffect* Coo
 	GetWorld()->GetTimerManager().SetTimer(NewCooldownDelayHandle, Del, Duration, false);
 
 	CurrentCooldownDelays.Add({ CooldownEffect, NewCooldownDelayHandle });
+	RebuildCooldownTagIndex();
 }
 
 void UPOTAbilitySystemComponentBase::ApplyAbilityCooldown(const TSubclassOf<UGameplayAbility>& InAbility, float CooldownTime)
@@ -1471,6 +1736,7 @@ void UPOTAbilitySystemComponentBase::ApplyAbilityCooldown(const TSubclassOf<UGam
 				float Delta = CooldownTime - ActiveCooldown->GetTimeRemaining(WorldTime);
 				ActiveCooldown->StartServerWorldTime += Delta;
 				ActiveCooldown->StartWorldTime += Delta;
+				RebuildCooldownTagIndex();
 
 				if (!OwnerChar->IsLocallyControlled()) // Replicate to client that this cooldown was adjusted, to ensure the UI is updated correctly
 				{
@@ -1526,4 +1792,5 @@ FActiveGameplayEffect UPOTAbilitySystemComponentBase::GetActiveEffect(const TSub
 void UPOTAbilitySystemComponentBase::ClearCurrentCooldownDelays()
 {
 	CurrentCooldownDelays.Empty();
+	RebuildCooldownTagIndex();
 }
\ No newline at end of file
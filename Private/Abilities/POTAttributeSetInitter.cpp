@@ -5,6 +5,13 @@
 #include "AbilitySystemComponent.h"
 #include "Serialization/Csv/CsvParser.h"
 
+DECLARE_CYCLE_STAT(TEXT("Update Attribute Defaults Gradient"), STAT_UpdateAttributeSetDefaultsGradient, STATGROUP_Game);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Gradient Attributes Written"), STAT_GradientAttributesWritten, STATGROUP_Game);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Gradient Attributes Unchanged"), STAT_GradientAttributesUnchanged, STATGROUP_Game);
+
+// Interpolated values closer than this to the current base value are not written again
+static constexpr float GradientWriteTolerance = 1.e-4f;
+
 TSubclassOf<UAttributeSet> FPOTAttributeSetInitter::FindBestAttributeClass(TArray<TSubclassOf<UAttributeSet> >& ClassList, FString PartialName)
 {
 	for (auto Class : ClassList)
@@ -276,6 +283,8 @@ void FPOTAttributeSetInitter::PreloadCurveData(const TArray<UCurveTable*>& Curve
 			PreloadRow(RowName, ClassName, SetName, AttributeName, CurveRow.Value, InDefaults);
 		}
 	}
+
+	ClassifyGrowthVaryingAttributes(InDefaults);
 }
 
 void FPOTAttributeSetInitter::PreloadCurveDataFromCSV(const FString& CSV, TMap<FName, FPOTAttributeSetDefaultsCollection>& InDefaults)
@@ -330,6 +339,8 @@ void FPOTAttributeSetInitter::PreloadCurveDataFromCSV(const FString& CSV, TMap<F
 			Key++;
 		}
 	}
+
+	ClassifyGrowthVaryingAttributes(InDefaults);
 }
 
 bool FPOTAttributeSetInitter::PreloadRow(const FString& RowName, const FString& ClassName, const FString& SetName, const FString& AttributeName, const FRealCurve* Curve, TMap<FName, FPOTAttributeSetDefaultsCollection>& InDefaults)
@@ -415,19 +426,16 @@ bool FPOTAttributeSetInitter::PreloadRow(const FString& RowName, const FString&
 	return true;
 }
 
-void FPOTAttributeSetInitter::InitAttributeSetDefaultsGradient(UAbilitySystemComponent* AbilitySystemComponent, FName GroupName, float Level, bool bInitialInit) const
+const FPOTAttributeSetInitter::FPOTAttributeSetDefaultsCollection* FPOTAttributeSetInitter::FindGradientCollection(FName GroupName, const FPOTAttributeSetDefaultsCollection*& OutModCollection) const
 {
-	check(AbilitySystemComponent != nullptr);
-
-
 	const FPOTAttributeSetDefaultsCollection* Collection = Defaults.Find(GroupName);
-	const FPOTAttributeSetDefaultsCollection* ModCollection = ModDefaults.Find(GroupName);
+	OutModCollection = ModDefaults.Find(GroupName);
 
 	if (!Collection)
 	{
-		if (ModCollection)
+		if (OutModCollection)
 		{
-			Collection = ModCollection;
+			Collection = OutModCollection;
 		}
 		else
 		{
@@ -436,10 +444,50 @@ void FPOTAttributeSetInitter::InitAttributeSetDefaultsGradient(UAbilitySystemCom
 			if (!Collection)
 			{
 				ABILITY_LOG(Error, TEXT("FAttributeSetInitterDiscreteLevels::InitAttributeSetDefaults Default DefaultAttributeSet not found! Skipping Initialization"));
-				return;
 			}
 		}
-		
+	}
+
+	return Collection;
+}
+
+bool FPOTAttributeSetInitter::LerpAttributeDefault(const FProperty* Property, int32 HintIndex, const FPOTAttributeDefaultValueList& Bottom, const FPOTAttributeDefaultValueList& Top,
+	const FPOTAttributeDefaultValueList* ModBottom, const FPOTAttributeDefaultValueList* ModTop, float Alpha, float& OutValue)
+{
+	if (ModBottom != nullptr && ModTop != nullptr)
+	{
+		const FPOTAttributeDefaultValueList::FOffsetValuePair* ModBottomPair = ModBottom->FindPair(Property, HintIndex);
+		const FPOTAttributeDefaultValueList::FOffsetValuePair* ModTopPair = ModTop->FindPair(Property, HintIndex);
+
+		if (ModBottomPair != nullptr && ModTopPair != nullptr)
+		{
+			OutValue = FMath::Lerp(ModBottomPair->Value, ModTopPair->Value, Alpha);
+			return true;
+		}
+	}
+
+	const FPOTAttributeDefaultValueList::FOffsetValuePair* BottomPair = Bottom.FindPair(Property, HintIndex);
+	const FPOTAttributeDefaultValueList::FOffsetValuePair* TopPair = Top.FindPair(Property, HintIndex);
+
+	if (BottomPair == nullptr || TopPair == nullptr)
+	{
+		return false;
+	}
+
+	OutValue = FMath::Lerp(BottomPair->Value, TopPair->Value, Alpha);
+	return true;
+}
+
+void FPOTAttributeSetInitter::InitAttributeSetDefaultsGradient(UAbilitySystemComponent* AbilitySystemComponent, FName GroupName, float Level, bool bInitialInit) const
+{
+	check(AbilitySystemComponent != nullptr);
+
+	const FPOTAttributeSetDefaultsCollection* ModCollection = nullptr;
+	const FPOTAttributeSetDefaultsCollection* Collection = FindGradientCollection(GroupName, ModCollection);
+
+	if (!Collection)
+	{
+		return;
 	}
 
 	int32 BottomLevel = FMath::FloorToInt(Level);
@@ -448,12 +496,13 @@ void FPOTAttributeSetInitter::InitAttributeSetDefaultsGradient(UAbilitySystemCom
 	if (!Collection->LevelData.IsValidIndex(BottomLevel - 1) || !Collection->LevelData.IsValidIndex(TopLevel - 1))
 	{
 		// We could eventually extrapolate values outside of the max defined levels
-		ABILITY_LOG(Warning, TEXT("Attribute defaults for Level %d are not defined! Skipping"), Level);
+		ABILITY_LOG(Warning, TEXT("Attribute defaults for Level %f are not defined! Skipping"), Level);
 		return;
 	}
 
 	const FPOTAttributeSetDefaults& BottomSetDefaults = Collection->LevelData[BottomLevel - 1];
 	const FPOTAttributeSetDefaults& TopSetDefaults = Collection->LevelData[TopLevel - 1];
+	const float Alpha = FMath::Frac(Level);
 
 	for (const UAttributeSet* Set : AbilitySystemComponent->GetSpawnedAttributes()) // this might need to be GetSpawnedAttributes_Mutable
 	{
@@ -483,32 +532,180 @@ void FPOTAttributeSetInitter::InitAttributeSetDefaultsGradient(UAbilitySystemCom
 
 			for (int32 i = 0; i < DefaultDataList->List.Num(); i++)
 			{
+				FProperty* const Property = DefaultDataList->List[i].Property;
+				check(Property);
 
-				auto DataPairBottom = DefaultDataList->List[i];
-				auto DataPairTop = TopDefaultDataList->List[i];
+				float ActualValue = 0.f;
+				if (Set->ShouldInitProperty(bInitialInit, Property) && LerpAttributeDefault(Property, i, *DefaultDataList, *TopDefaultDataList, ModDefaultDataList, ModTopDefaultDataList, Alpha, ActualValue))
+				{
+					AbilitySystemComponent->SetNumericAttributeBase(FGameplayAttribute(Property), ActualValue);
+				}
+			}
+		}
+	}
 
-				if (ModDefaultDataList != nullptr && ModTopDefaultDataList != nullptr 
-					&& ModDefaultDataList->List.IsValidIndex(i) && ModTopDefaultDataList->List.IsValidIndex(i))
+	AbilitySystemComponent->ForceReplication();
+}
+
+int32 FPOTAttributeSetInitter::UpdateAttributeSetDefaultsGradient(UAbilitySystemComponent* AbilitySystemComponent, FName GroupName, float Level) const
+{
+	check(AbilitySystemComponent != nullptr);
+	SCOPE_CYCLE_COUNTER(STAT_UpdateAttributeSetDefaultsGradient);
+
+	const FPOTAttributeSetDefaultsCollection* ModCollection = nullptr;
+	const FPOTAttributeSetDefaultsCollection* Collection = FindGradientCollection(GroupName, ModCollection);
+
+	if (!Collection)
+	{
+		return 0;
+	}
+
+	int32 BottomLevel = FMath::FloorToInt(Level);
+	int32 TopLevel = FMath::CeilToInt(Level);
+
+	if (!Collection->LevelData.IsValidIndex(BottomLevel - 1) || !Collection->LevelData.IsValidIndex(TopLevel - 1))
+	{
+		ABILITY_LOG(Warning, TEXT("Attribute defaults for Level %f are not defined! Skipping"), Level);
+		return 0;
+	}
+
+	const bool bUseModData = ModCollection != nullptr && ModCollection != Collection && ModCollection->LevelData.IsValidIndex(BottomLevel - 1) && ModCollection->LevelData.IsValidIndex(TopLevel - 1);
+
+	const FPOTAttributeSetDefaults& BottomSetDefaults = Collection->LevelData[BottomLevel - 1];
+	const FPOTAttributeSetDefaults& TopSetDefaults = Collection->LevelData[TopLevel - 1];
+	const float Alpha = FMath::Frac(Level);
+
+	int32 NumWritten = 0;
+	int32 NumUnchanged = 0;
+
+	for (const UAttributeSet* Set : AbilitySystemComponent->GetSpawnedAttributes())
+	{
+		if (!Set)
+		{
+			continue;
+		}
+
+		const FPOTAttributeDefaultValueList* DefaultDataList = BottomSetDefaults.DataMap.Find(Set->GetClass());
+		const FPOTAttributeDefaultValueList* TopDefaultDataList = TopSetDefaults.DataMap.Find(Set->GetClass());
+
+		if (!DefaultDataList || !TopDefaultDataList)
+		{
+			continue;
+		}
+
+		const FPOTAttributeDefaultValueList* ModDefaultDataList = nullptr;
+		const FPOTAttributeDefaultValueList* ModTopDefaultDataList = nullptr;
+		const TArray<FPOTGrowthVaryingAttribute>* ModVaryingAttributes = nullptr;
+
+		if (bUseModData)
+		{
+			ModDefaultDataList = ModCollection->LevelData[BottomLevel - 1].DataMap.Find(Set->GetClass());
+			ModTopDefaultDataList = ModCollection->LevelData[TopLevel - 1].DataMap.Find(Set->GetClass());
+			ModVaryingAttributes = ModCollection->GrowthVaryingAttributes.Find(Set->GetClass());
+		}
+
+		const TArray<FPOTGrowthVaryingAttribute>* VaryingAttributes = Collection->GrowthVaryingAttributes.Find(Set->GetClass());
+
+		auto UpdateAttribute = [&](const FPOTGrowthVaryingAttribute& Varying)
+		{
+			float NewValue = 0.f;
+			if (!Set->ShouldInitProperty(false, Varying.Property)
+				|| !LerpAttributeDefault(Varying.Property, Varying.ListIndex, *DefaultDataList, *TopDefaultDataList, ModDefaultDataList, ModTopDefaultDataList, Alpha, NewValue))
+			{
+				return;
+			}
+
+			const FGameplayAttribute AttributeToModify(Varying.Property);
+			if (FMath::IsNearlyEqual(AbilitySystemComponent->GetNumericAttributeBase(AttributeToModify), NewValue, GradientWriteTolerance))
+			{
+				NumUnchanged++;
+				return;
+			}
+
+			AbilitySystemComponent->SetNumericAttributeBase(AttributeToModify, NewValue);
+			NumWritten++;
+		};
+
+		if (VaryingAttributes)
+		{
+			for (const FPOTGrowthVaryingAttribute& Varying : *VaryingAttributes)
+			{
+				UpdateAttribute(Varying);
+			}
+		}
+
+		if (ModVaryingAttributes)
+		{
+			for (const FPOTGrowthVaryingAttribute& Varying : *ModVaryingAttributes)
+			{
+				const bool bAlreadyUpdated = VaryingAttributes != nullptr && VaryingAttributes->ContainsByPredicate([&Varying](const FPOTGrowthVaryingAttribute& Other) { return Other.Property == Varying.Property; });
+				if (!bAlreadyUpdated)
 				{
-					DataPairBottom = ModDefaultDataList->List[i];
-					DataPairTop = ModTopDefaultDataList->List[i];
+					UpdateAttribute(Varying);
 				}
+			}
+		}
+	}
 
-				
-				check(DataPairBottom.Property && DataPairTop.Property);
+	INC_DWORD_STAT_BY(STAT_GradientAttributesWritten, NumWritten);
+	INC_DWORD_STAT_BY(STAT_GradientAttributesUnchanged, NumUnchanged);
+	ABILITY_LOG(Verbose, TEXT("UpdateAttributeSetDefaultsGradient %s level %f: %d attributes written, %d unchanged"), *GroupName.ToString(), Level, NumWritten, NumUnchanged);
 
-				if (Set->ShouldInitProperty(bInitialInit, DataPairBottom.Property))
+	if (NumWritten > 0)
+	{
+		AbilitySystemComponent->ForceReplication();
+	}
+
+	return NumWritten;
+}
+
+void FPOTAttributeSetInitter::ClassifyGrowthVaryingAttributes(TMap<FName, FPOTAttributeSetDefaultsCollection>& InDefaults)
+{
+	for (TPair<FName, FPOTAttributeSetDefaultsCollection>& CollectionPair : InDefaults)
+	{
+		FPOTAttributeSetDefaultsCollection& Collection = CollectionPair.Value;
+		Collection.GrowthVaryingAttributes.Reset();
+
+		// The first level that defines a set is the reference the other levels are compared against
+		TMap<TSubclassOf<UAttributeSet>, const FPOTAttributeDefaultValueList*> ReferenceLists;
+
+		for (const FPOTAttributeSetDefaults& SetDefaults : Collection.LevelData)
+		{
+			for (const TPair<TSubclassOf<UAttributeSet>, FPOTAttributeDefaultValueList>& DataPair : SetDefaults.DataMap)
+			{
+				const FPOTAttributeDefaultValueList*& ReferenceList = ReferenceLists.FindOrAdd(DataPair.Key);
+				if (ReferenceList == nullptr)
 				{
-					FGameplayAttribute AttributeToModify(DataPairBottom.Property);
-					float ActualValue = FMath::Lerp(DataPairBottom.Value, DataPairTop.Value, FMath::Frac(Level));
+					ReferenceList = &DataPair.Value;
+					continue;
+				}
 
-					AbilitySystemComponent->SetNumericAttributeBase(AttributeToModify, ActualValue);
+				TArray<FPOTGrowthVaryingAttribute>& VaryingAttributes = Collection.GrowthVaryingAttributes.FindOrAdd(DataPair.Key);
+
+				for (int32 i = 0; i < DataPair.Value.List.Num(); i++)
+				{
+					const FPOTAttributeDefaultValueList::FOffsetValuePair& Pair = DataPair.Value.List[i];
+					const FPOTAttributeDefaultValueList::FOffsetValuePair* ReferencePair = ReferenceList->FindPair(Pair.Property, i);
+
+					// Properties missing from some levels are treated as varying, the runtime lookup will skip them where undefined
+					if (ReferencePair != nullptr && FMath::IsNearlyEqual(ReferencePair->Value, Pair.Value, GradientWriteTolerance))
+					{
+						continue;
+					}
+
+					if (!VaryingAttributes.ContainsByPredicate([&Pair](const FPOTGrowthVaryingAttribute& Varying) { return Varying.Property == Pair.Property; }))
+					{
+						const int32 ReferenceIndex = ReferencePair != nullptr ? UE_PTRDIFF_TO_INT32(ReferencePair - ReferenceList->List.GetData()) : i;
+						VaryingAttributes.Add({ Pair.Property, ReferenceIndex });
+					}
 				}
 			}
 		}
+
+		ABILITY_LOG(Verbose, TEXT("ClassifyGrowthVaryingAttributes %s: %d set classes with growth-varying attributes"), *CollectionPair.Key.ToString(), Collection.GrowthVaryingAttributes.Num());
 	}
 
-	AbilitySystemComponent->ForceReplication();
+	DefaultsVersion++;
 }
 
 void FPOTAttributeSetInitter::ApplyAttributeDefaultGradient(UAbilitySystemComponent* AbilitySystemComponent, FGameplayAttribute& InAttribute, FName GroupName, float Level) const
@@ -25,9 +25,27 @@
 #include "Online/IGameSession.h"
 #include "Online/IGameState.h"
 #include "IWorldSettings.h"
+#include "ProfilingDebugging/CsvProfiler.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogICharacterMovement, Log, All);
 
+// Server move processing, run a dedicated server with -csvprofile to record these per frame for comparison between builds
+DECLARE_CYCLE_STAT(TEXT("POT ServerMove PerformMovement"), STAT_POTServerMovePerformMovement, STATGROUP_Character);
+DECLARE_CYCLE_STAT(TEXT("POT ServerMove HandleClientError"), STAT_POTServerMoveHandleClientError, STATGROUP_Character);
+DECLARE_CYCLE_STAT(TEXT("POT OnTimeDiscrepancyDetected"), STAT_POTOnTimeDiscrepancyDetected, STATGROUP_Character);
+DECLARE_CYCLE_STAT(TEXT("POT SimulateMovement"), STAT_POTSimulateMovement, STATGROUP_Character);
+DECLARE_DWORD_COUNTER_STAT(TEXT("POT Server Moves"), STAT_POTServerMoves, STATGROUP_Character);
+DECLARE_DWORD_COUNTER_STAT(TEXT("POT Server Move Corrections"), STAT_POTServerMoveCorrections, STATGROUP_Character);
+DECLARE_DWORD_COUNTER_STAT(TEXT("POT Time Discrepancies"), STAT_POTTimeDiscrepancies, STATGROUP_Character);
+DECLARE_DWORD_COUNTER_STAT(TEXT("POT Move Parameter Resolves"), STAT_POTMoveParameterResolves, STATGROUP_Character);
+DECLARE_DWORD_COUNTER_STAT(TEXT("POT Move Parameter Hits"), STAT_POTMoveParameterHits, STATGROUP_Character);
+DECLARE_DWORD_COUNTER_STAT(TEXT("POT Proxies High Significance"), STAT_POTProxiesHigh, STATGROUP_Character);
+DECLARE_DWORD_COUNTER_STAT(TEXT("POT Proxies Medium Significance"), STAT_POTProxiesMedium, STATGROUP_Character);
+DECLARE_DWORD_COUNTER_STAT(TEXT("POT Proxies Low Significance"), STAT_POTProxiesLow, STATGROUP_Character);
+DECLARE_DWORD_COUNTER_STAT(TEXT("POT Proxy Extrapolated Frames"), STAT_POTProxyExtrapolatedFrames, STATGROUP_Character);
+
+CSV_DEFINE_CATEGORY(POTServerMove, true);
+
 // CVars
 namespace ICharacterMovementCVars
 {
@@ -71,6 +89,24 @@ namespace ICharacterMovementCVars
 		TEXT("If 1 movements from clients will be approximated for verification. \n"),
 		ECVF_Default);
 
+	static TAutoConsoleVariable<bool> CVarProxyMovementLOD(
+		TEXT("pot.ProxyMovementLOD"),
+		true,
+		TEXT("If true, remote characters that are small on screen are simulated at a reduced rate. \n"),
+		ECVF_Default);
+
+	static TAutoConsoleVariable<float> CVarProxyMovementLODMediumScreenSize(
+		TEXT("pot.ProxyMovementLODMediumScreenSize"),
+		0.02f,
+		TEXT("Bounds radius / view distance below which a remote character drops to medium significance. \n"),
+		ECVF_Default);
+
+	static TAutoConsoleVariable<float> CVarProxyMovementLODLowScreenSize(
+		TEXT("pot.ProxyMovementLODLowScreenSize"),
+		0.006f,
+		TEXT("Bounds radius / view distance below which a remote character drops to low significance. \n"),
+		ECVF_Default);
+
 	/*
 	These console variables (NetUseBaseRelativeAcceleration and NetUseBaseRelativeVelocity) are already declared
 	in CharacterMovementComponent.cpp, which is an engine class. We are declaring them here again so that we can
@@ -204,6 +240,10 @@ void UICharacterMovementComponent::SetDefaultMovementMode()
 
 void UICharacterMovementComponent::SimulateMovement(float DeltaSeconds)
 {
+	SCOPE_CYCLE_COUNTER(STAT_POTSimulateMovement);
+
+	InvalidateMoveParameters();
+
 	if (bJustTeleported)
 	{
 		ICharacterMovementCVars::CVarAlwaysMovingForward->Set(false);
@@ -237,6 +277,16 @@ void UICharacterMovementComponent::SimulateMovement(float DeltaSeconds)
 		return;
 	}
 
+	if (bIsSimulatedProxy)
+	{
+		UpdateProxySignificance(DeltaSeconds);
+
+		if (TryExtrapolateProxy(DeltaSeconds))
+		{
+			return;
+		}
+	}
+
 
 	AIBaseCharacter* IBaseCharacter = Cast<AIBaseCharacter>(CharacterOwner.Get());
 	
@@ -330,7 +380,11 @@ void UICharacterMovementComponent::SimulateMovement(float DeltaSeconds)
 				}
 				else if (Velocity.Z <= 0.f)
 				{
-					FindFloor(UpdatedComponent->GetComponentLocation(), CurrentFloor, Velocity.IsZero(), NULL);
+					// Low significance proxies keep the floor they are walking on, falling ones still look for ground to land on
+					if (!bIsSimulatedProxy || ProxySignificance != EProxyMovementSignificance::Low || !IsMovingOnGround() || !CurrentFloor.IsWalkableFloor())
+					{
+						FindFloor(UpdatedComponent->GetComponentLocation(), CurrentFloor, Velocity.IsZero(), NULL);
+					}
 				}
 				else
 				{
@@ -416,6 +470,143 @@ void UICharacterMovementComponent::SimulateMovement(float DeltaSeconds)
 	LastUpdateVelocity = Velocity;
 }
 
+EProxyMovementSignificance UICharacterMovementComponent::CalculateProxySignificance() const
+{
+	if (!ICharacterMovementCVars::CVarProxyMovementLOD->GetBool() || !CharacterOwner || !UpdatedComponent)
+	{
+		return EProxyMovementSignificance::High;
+	}
+
+	// Anything attacking stays fully simulated, its position matters for hits and blocking
+	if (const AIBaseCharacter* BaseOwner = GetMoveParameters().BaseOwner)
+	{
+		if (BaseOwner->IsAttacking())
+		{
+			return EProxyMovementSignificance::High;
+		}
+	}
+
+	const APlayerController* const LocalController = GetWorld() ? GetWorld()->GetFirstPlayerController() : nullptr;
+	if (!LocalController)
+	{
+		return EProxyMovementSignificance::High;
+	}
+
+	FVector ViewLocation;
+	FRotator ViewRotation;
+	LocalController->GetPlayerViewPoint(ViewLocation, ViewRotation);
+
+	// Approximate screen size, ignores field of view
+	const float ViewDistance = FVector::Dist(ViewLocation, UpdatedComponent->GetComponentLocation());
+	const float ScreenSize = ViewDistance > KINDA_SMALL_NUMBER ? UpdatedComponent->Bounds.SphereRadius / ViewDistance : 1.f;
+
+	EProxyMovementSignificance Significance = EProxyMovementSignificance::High;
+	if (ScreenSize < ICharacterMovementCVars::CVarProxyMovementLODLowScreenSize->GetFloat())
+	{
+		Significance = EProxyMovementSignificance::Low;
+	}
+	else if (ScreenSize < ICharacterMovementCVars::CVarProxyMovementLODMediumScreenSize->GetFloat())
+	{
+		Significance = EProxyMovementSignificance::Medium;
+	}
+
+	// Off screen characters drop one more level
+	if (Significance != EProxyMovementSignificance::Low && !CharacterOwner->WasRecentlyRendered(0.5f))
+	{
+		Significance = static_cast<EProxyMovementSignificance>(static_cast<uint8>(Significance) + 1);
+	}
+
+	return Significance;
+}
+
+void UICharacterMovementComponent::UpdateProxySignificance(float DeltaSeconds)
+{
+	ProxySignificanceCountdown -= DeltaSeconds;
+	if (ProxySignificanceCountdown <= 0.f)
+	{
+		// Re-evaluated a couple of times a second, staggered so proxies don't all evaluate on the same frame
+		ProxySignificanceCountdown = FMath::FRandRange(0.4f, 0.6f);
+		ProxySignificance = CalculateProxySignificance();
+	}
+
+	switch (ProxySignificance)
+	{
+		case EProxyMovementSignificance::High:
+			INC_DWORD_STAT(STAT_POTProxiesHigh);
+			break;
+		case EProxyMovementSignificance::Medium:
+			INC_DWORD_STAT(STAT_POTProxiesMedium);
+			break;
+		case EProxyMovementSignificance::Low:
+			INC_DWORD_STAT(STAT_POTProxiesLow);
+			break;
+	}
+}
+
+bool UICharacterMovementComponent::TryExtrapolateProxy(float DeltaSeconds)
+{
+	// Seconds between full simulation steps for medium and low significance
+	static constexpr float MediumSimulationInterval = 1.f / 30.f;
+	static constexpr float LowSimulationInterval = 1.f / 10.f;
+
+	ProxyTimeSinceSimulation += DeltaSeconds;
+
+	// Network updates, teleports, anything airborne and anything standing on a moving base always get the full path
+	if (ProxySignificance == EProxyMovementSignificance::High
+		|| bNetworkUpdateReceived
+		|| bJustTeleported
+		|| bForceNextFloorCheck
+		|| MovementMode == MOVE_Falling
+		|| MovementMode == MOVE_None
+		|| MovementBaseUtility::UseRelativeLocation(GetMovementBase()))
+	{
+		ProxyTimeSinceSimulation = 0.f;
+		return false;
+	}
+
+	const float SimulationInterval = ProxySignificance == EProxyMovementSignificance::Low ? LowSimulationInterval : MediumSimulationInterval;
+	if (ProxyTimeSinceSimulation >= SimulationInterval)
+	{
+		ProxyTimeSinceSimulation = 0.f;
+		return false;
+	}
+
+	INC_DWORD_STAT(STAT_POTProxyExtrapolatedFrames);
+
+	const FVector OldVelocity = Velocity;
+	const FVector OldLocation = UpdatedComponent->GetComponentLocation();
+
+	{
+		FScopedMovementUpdate ScopedMovementUpdate(UpdatedComponent, bEnableScopedMovementUpdates ? EScopedUpdate::DeferredUpdates : EScopedUpdate::ImmediateUpdates);
+
+		MaybeUpdateBasedMovement(DeltaSeconds);
+
+		if (!Velocity.IsNearlyZero())
+		{
+			// Follow the slope of the floor so walking proxies don't slide into or off ramps until the next full step
+			FVector Delta = Velocity * DeltaSeconds;
+			if (IsMovingOnGround() && CurrentFloor.IsWalkableFloor())
+			{
+				Delta = ComputeGroundMovementDelta(Delta, CurrentFloor.HitResult, CurrentFloor.bLineTrace);
+			}
+
+			MoveUpdatedComponent(Delta, UpdatedComponent->GetComponentQuat(), false);
+		}
+
+		OnMovementUpdated(DeltaSeconds, OldLocation, OldVelocity);
+	}
+
+	// Same post movement calls as a full step
+	CallMovementUpdateDelegate(DeltaSeconds, OldLocation, OldVelocity);
+	MaybeSaveBaseLocation();
+	UpdateComponentVelocity();
+
+	LastUpdateLocation = UpdatedComponent->GetComponentLocation();
+	LastUpdateRotation = UpdatedComponent->GetComponentQuat();
+	LastUpdateVelocity = Velocity;
+	return true;
+}
+
 void UICharacterMovementComponent::FindFloor(const FVector& CapsuleLocation, FFindFloorResult& OutFloorResult, bool bCanUseCachedLocation, const FHitResult* DownwardSweepResult) const
 {
 	FFindFloorResult CurrentFloorResult = OutFloorResult;
@@ -645,7 +836,9 @@ float UICharacterMovementComponent::GetMaxSpeedSlopeModifier() const
 	{
 		if (!ShouldUsePreciseMovement())
 		{
-			float SlopeAngle = UKismetMathLibrary::MakeRotationFromAxes(FVector::CrossProduct(UpdatedComponent->GetRightVector(), CurrentFloor.HitResult.Normal).GetSafeNormal(0.0001f), UpdatedComponent->GetRightVector(), CurrentFloor.HitResult.Normal).Pitch * -1.0f;
+			// Only the pitch of the slope's forward axis is needed, no need to build the whole rotation for it
+			const FVector SlopeForward = FVector::CrossProduct(UpdatedComponent->GetRightVector(), CurrentFloor.HitResult.Normal).GetSafeNormal(0.0001f);
+			float SlopeAngle = FMath::RadiansToDegrees(FMath::Atan2(SlopeForward.Z, FMath::Sqrt(FMath::Square(SlopeForward.X) + FMath::Square(SlopeForward.Y)))) * -1.0f;
 
 			if (fabsf(SlopeAngle) > 15.0f)
 			{
@@ -697,27 +890,63 @@ bool UICharacterMovementComponent::IsStandingOnCharacter() const
 	return false;
 }
 
+const FPOTMoveParameters& UICharacterMovementComponent::GetMoveParameters() const
+{
+	if (MoveParameters.bValid && MoveParameters.ResolvedFor == PawnOwner)
+	{
+		INC_DWORD_STAT(STAT_POTMoveParameterHits);
+		return MoveParameters;
+	}
+
+	INC_DWORD_STAT(STAT_POTMoveParameterResolves);
+
+	MoveParameters = FPOTMoveParameters();
+	MoveParameters.ResolvedFor = PawnOwner;
+	MoveParameters.bValid = true;
+
+	MoveParameters.BaseOwner = Cast<AIBaseCharacter>(PawnOwner);
+	if (!MoveParameters.BaseOwner)
+	{
+		return MoveParameters;
+	}
+
+	MoveParameters.AbilitySystem = MoveParameters.BaseOwner->AbilitySystem;
+	MoveParameters.AdminOwner = Cast<AIAdminCharacter>(MoveParameters.BaseOwner);
+	MoveParameters.DinoOwner = Cast<AIDinosaurCharacter>(MoveParameters.BaseOwner);
+
+	if (const AIDinosaurCharacter* const DinoOwner = MoveParameters.DinoOwner)
+	{
+		MoveParameters.SpeedGrowthMultiplier = DinoOwner->GetSpeedGrowthMultiplier();
+		MoveParameters.SwimSpeedGrowthMultiplier = DinoOwner->GetSwimSpeedGrowthMultiplier();
+		MoveParameters.FlySpeedGrowthMultiplier = DinoOwner->GetFlySpeedGrowthMultiplier();
+		MoveParameters.AccelerationGrowthMultiplier = DinoOwner->GetAccelerationGrowthMultiplier();
+	}
+
+	return MoveParameters;
+}
+
 float UICharacterMovementComponent::GetMaxSpeed() const
 {
 	float MaxSpeed = Super::GetMaxSpeed();
 	float MaxSpeedMultiplier = 1.0f;
 
-	AIBaseCharacter* CharOwner = Cast<AIBaseCharacter>(PawnOwner);
-	AIDinosaurCharacter* DinoOwner = Cast<AIDinosaurCharacter>(PawnOwner);
+	const FPOTMoveParameters& Params = GetMoveParameters();
+	AIBaseCharacter* CharOwner = Params.BaseOwner;
+	AIDinosaurCharacter* DinoOwner = Params.DinoOwner;
 
 	if (DinoOwner)
 	{
 		if (IsSwimming())
 		{
-			MaxSpeedMultiplier = DinoOwner->GetSwimSpeedGrowthMultiplier();
+			MaxSpeedMultiplier = Params.SwimSpeedGrowthMultiplier;
 		}
 		else if (IsFlying())
 		{
-			MaxSpeedMultiplier = DinoOwner->GetFlySpeedGrowthMultiplier();
+			MaxSpeedMultiplier = Params.FlySpeedGrowthMultiplier;
 		}
 		else
 		{
-			MaxSpeedMultiplier = DinoOwner->GetSpeedGrowthMultiplier();
+			MaxSpeedMultiplier = Params.SpeedGrowthMultiplier;
 		}
 	}
 
@@ -726,7 +955,7 @@ float UICharacterMovementComponent::GetMaxSpeed() const
 		bool bOverrideSpeed = false;
 		if (DinoOwner && !IsLimping())
 		{
-			if (UPOTAbilitySystemComponent* AbilitySystem = Cast<UPOTAbilitySystemComponent>(DinoOwner->AbilitySystem))
+			if (UPOTAbilitySystemComponent* AbilitySystem = Params.AbilitySystem)
 			{
 				float AbilitySpeedOverride = AbilitySystem->GetAbilityForcedMovementSpeed();
 				bOverrideSpeed = AbilitySpeedOverride > 0.0f;
@@ -787,7 +1016,7 @@ float UICharacterMovementComponent::GetMaxSpeed() const
 				}
 				else if (IsFlying())
 				{
-					MaxSpeed = (bWantsToSprint && !IsLimping()) || Cast<AIAdminCharacter>(CharOwner) != nullptr ? MaxFlySpeed : MaxFlySlowSpeed;
+					MaxSpeed = (bWantsToSprint && !IsLimping()) || Params.AdminOwner != nullptr ? MaxFlySpeed : MaxFlySlowSpeed;
 
 					if (DinoOwner)
 					{
@@ -849,7 +1078,7 @@ float UICharacterMovementComponent::GetMaxSpeed() const
 						}
 					}
 
-					if (AIAdminCharacter* IAdminCharacter = Cast<AIAdminCharacter>(CharOwner))
+					if (AIAdminCharacter* IAdminCharacter = Params.AdminOwner)
 					{
 						MaxSpeed *= 2;
 						if (MaxSpeed < IAdminCharacter->MaxFlySpeed)
@@ -898,9 +1127,11 @@ float UICharacterMovementComponent::GetMaxAcceleration() const
 		return Super::GetMaxAcceleration();
 	}
 
-	if (AIDinosaurCharacter* DinoOwner = Cast<AIDinosaurCharacter>(GetOwner()))
+	const FPOTMoveParameters& Params = GetMoveParameters();
+
+	if (AIDinosaurCharacter* DinoOwner = Params.DinoOwner)
 	{
-		const float MaxAccelerationMultiplier = DinoOwner->GetAccelerationGrowthMultiplier();
+		const float MaxAccelerationMultiplier = Params.AccelerationGrowthMultiplier;
 
 		float GroundAccelerationMultiplier = 1.0f;
 		float SwimAccelerationMultiplier = 1.0f;
@@ -973,7 +1204,7 @@ float UICharacterMovementComponent::GetMaxAcceleration() const
 		return BaseAcceleration * MaxAccelerationMultiplier;
 	}
 
-	if (AIBaseCharacter* CharOwner = Cast<AIBaseCharacter>(PawnOwner))
+	if (Params.BaseOwner)
 	{
 		if (bWantsToStop)
 		{
@@ -1000,7 +1231,9 @@ FVector UICharacterMovementComponent::GetAirControl(float DeltaTime, float TickA
 	const FVector& FallAcceleration)
 {
 	float AirControMultiplier = 1.f;
-	if (UAbilitySystemComponent* ASC = UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(GetOwner()))
+	const FPOTMoveParameters& Params = GetMoveParameters();
+	UAbilitySystemComponent* ASC = Params.BaseOwner ? Params.AbilitySystem : UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(GetOwner());
+	if (ASC)
 	{
 		AirControMultiplier = ASC->GetNumericAttribute(UCoreAttributeSet::GetAirControlMultiplierAttribute());
 	}
@@ -1011,7 +1244,7 @@ FVector UICharacterMovementComponent::GetAirControl(float DeltaTime, float TickA
 
 float UICharacterMovementComponent::GetGravityZ() const
 {
-	if (AIBaseCharacter* ICharOwner = Cast<AIBaseCharacter>(GetOwner()))
+	if (const AIBaseCharacter* ICharOwner = GetMoveParameters().BaseOwner)
 	{
 		// Removed Checks:
 		// ICharOwner->GetController() == nullptr
@@ -1342,6 +1575,10 @@ FRotator UICharacterMovementComponent::ComputeOrientToMovementRotation(const FRo
 
 void UICharacterMovementComponent::OnTimeDiscrepancyDetected(float CurrentTimeDiscrepancy, float LifetimeRawTimeDiscrepancy, float Lifetime, float CurrentMoveError)
 {
+	SCOPE_CYCLE_COUNTER(STAT_POTOnTimeDiscrepancyDetected);
+	INC_DWORD_STAT(STAT_POTTimeDiscrepancies);
+	CSV_CUSTOM_STAT(POTServerMove, TimeDiscrepancies, 1, ECsvCustomStatOp::Accumulate);
+
 	Super::OnTimeDiscrepancyDetected(CurrentTimeDiscrepancy, LifetimeRawTimeDiscrepancy, Lifetime, CurrentMoveError);
 
 	const UIGameInstance* const IGameInstance = UIGameplayStatics::GetIGameInstance(this);
@@ -2991,6 +3228,9 @@ void UICharacterMovementComponent::UpdateBuoyancy(const AIDinosaurCharacter& Din
 
 void UICharacterMovementComponent::TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
+	// Keeps queries made outside of a move (animation, AI) from holding on to a previous growth stage
+	InvalidateMoveParameters();
+
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
 	const AIDinosaurCharacter* const DinoCharacter = Cast<AIDinosaurCharacter>(PawnOwner);
@@ -3023,6 +3263,7 @@ void UICharacterMovementComponent::ControlledCharacterMove(const FVector& InputV
 
 void UICharacterMovementComponent::PerformMovement(float DeltaTime)
 {
+	InvalidateMoveParameters();
 	Super::PerformMovement(DeltaTime);
 }
 
@@ -3679,7 +3920,8 @@ bool UICharacterMovementComponent::MoveUpdatedComponentImpl(const FVector& Delta
 		return false;
 	}
 
-	if (!bUseMultiCapsuleCollision)
+	// Low significance proxies only sweep their root capsule
+	if (!bUseMultiCapsuleCollision || (ProxySignificance == EProxyMovementSignificance::Low && CharacterOwner && CharacterOwner->GetLocalRole() == ROLE_SimulatedProxy))
 	{
 		return Super::MoveUpdatedComponentImpl(Delta, Rotation, bSweep, OutHit, Teleport);
 	}
@@ -4991,6 +5233,9 @@ void UICharacterMovementComponent::ServerMove_HandleMoveData(const FCharacterNet
 
 void UICharacterMovementComponent::ServerMove_PerformMovement(const FCharacterNetworkMoveData& MoveData)
 {
+	SCOPE_CYCLE_COUNTER(STAT_POTServerMovePerformMovement);
+	CSV_SCOPED_TIMING_STAT(POTServerMove, PerformMovement);
+
 	if (!HasValidData() || !IsActive() || !IsComponentTickEnabled())
 	{
 		return;
@@ -5069,6 +5314,9 @@ void UICharacterMovementComponent::ServerMove_PerformMovement(const FCharacterNe
 		PC->UpdateRotation(DeltaTime);
 	}
 
+	INC_DWORD_STAT(STAT_POTServerMoves);
+	CSV_CUSTOM_STAT(POTServerMove, Moves, 1, ECsvCustomStatOp::Accumulate);
+
 	MoveAutonomous(ClientTimeStamp, DeltaTime, ClientMoveFlags, ClientAccel);
 	
 	// Validate move only after old and first dual portion, after all moves are completed.
@@ -5089,6 +5337,8 @@ void UICharacterMovementComponent::ServerMove_PerformMovement(const FCharacterNe
 
 void UICharacterMovementComponent::ServerMoveHandleClientErrorApproximate(float ClientTimeStamp, float DeltaTime, const FVector& Accel, const FPOTCharacterNetworkMoveData& POTMoveData)
 {
+	SCOPE_CYCLE_COUNTER(STAT_POTServerMoveHandleClientError);
+
 	const AIBaseCharacter* const IBaseChar = Cast<const AIBaseCharacter>(CharacterOwner);
 	check(IBaseChar);
 	
@@ -5182,12 +5432,17 @@ void UICharacterMovementComponent::ServerMoveHandleClientErrorApproximate(float
 		ServerData->PendingAdjustment.TimeStamp = ClientTimeStamp;
 		ServerData->PendingAdjustment.bAckGoodMove = false;
 		ServerData->PendingAdjustment.MovementMode = PackNetworkMovementMode();
+
+		INC_DWORD_STAT(STAT_POTServerMoveCorrections);
+		CSV_CUSTOM_STAT(POTServerMove, Corrections, 1, ECsvCustomStatOp::Accumulate);
 	}
 }
 
 // Same as Super function but with rotation taken into consideration
 void UICharacterMovementComponent::ServerMoveHandleClientErrorWithRotation(float ClientTimeStamp, float DeltaTime, const FVector& Accel, const FPOTCharacterNetworkMoveData& POTMoveData)
 {
+	SCOPE_CYCLE_COUNTER(STAT_POTServerMoveHandleClientError);
+
 	const FVector& RelativeClientLoc = POTMoveData.Location;
 	const FRotator& ClientRotation = POTMoveData.Rotation;
 	UPrimitiveComponent* ClientMovementBase = POTMoveData.MovementBase;
@@ -5341,6 +5596,9 @@ void UICharacterMovementComponent::ServerMoveHandleClientErrorWithRotation(float
 			ServerData->PendingAdjustment.TimeStamp = ClientTimeStamp;
 			ServerData->PendingAdjustment.bAckGoodMove = false;
 			ServerData->PendingAdjustment.MovementMode = PackNetworkMovementMode();
+
+			INC_DWORD_STAT(STAT_POTServerMoveCorrections);
+			CSV_CUSTOM_STAT(POTServerMove, Corrections, 1, ECsvCustomStatOp::Accumulate);
 		}
 	}
 	else
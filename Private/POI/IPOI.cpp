@@ -68,7 +68,7 @@ void AIPOI::PointOverlapBeginClient(AActor* OverlappedActor, AActor* OtherActor)
 				QuestMgr->OnLocationDiscovered(LocationTag, LocationDisplayName, IBaseCharacter, true, true, IBaseCharacter->IsTeleporting());
 			}
 		}
-		else
+		else if (!IsServerResolvingZones())
 		{
 			if (AIPlayerController* IPlayerController = Cast<AIPlayerController>(IBaseCharacter->GetController()))
 			{
@@ -107,7 +107,7 @@ void AIPOI::PointOverlapEndClient(AActor* OverlappedActor, AActor* OtherActor)
 				QuestMgr->OnLocationDiscovered(LocationTag, LocationDisplayName, IBaseCharacter, false, true, IBaseCharacter->IsTeleporting());
 			}
 		}
-		else
+		else if (!IsServerResolvingZones())
 		{
 			if (AIPlayerController* IPlayerController = Cast<AIPlayerController>(IBaseCharacter->GetController()))
 			{
@@ -117,6 +117,19 @@ void AIPOI::PointOverlapEndClient(AActor* OverlappedActor, AActor* OtherActor)
 	}
 }
 
+bool AIPOI::IsServerResolvingZones() const
+{
+	// The server replicates whether it built a zone grid, so clients only stop reporting overlaps when it actually resolves them
+	if (GetNetMode() != NM_Client)
+	{
+		return false;
+	}
+
+	const AIWorldSettings* WorldSettings = AIWorldSettings::GetWorldSettings(this);
+	const AIQuestManager* QuestMgr = WorldSettings ? WorldSettings->QuestManager : nullptr;
+	return QuestMgr && QuestMgr->IsResolvingPOIZones();
+}
+
 void AIPOI::PointOverlapBeginServer(AActor* OverlappedActor, AActor* OtherActor)
 {
 	// GEngine->AddOnScreenDebugMessage(-1, 10.0f, FColor::Green, FString::Printf(TEXT("AIPOI::PointOverlapBeginServer | %s, %s"), *OtherActor->GetName(), *LocationDisplayName.ToString()));
@@ -0,0 +1,403 @@
+// Copyright 2019-2022 Alderon Games Pty Ltd, All Rights Reserved.
+
+#include "Quests/IPOIZoneGrid.h"
+#include "Quests/IPOI.h"
+#include "Player/IBaseCharacter.h"
+#include "Components/StaticMeshComponent.h"
+#include "Engine/StaticMesh.h"
+#include "PhysicsEngine/BodySetup.h"
+
+DECLARE_CYCLE_STAT(TEXT("POI Zone Membership"), STAT_POIZoneMembership, STATGROUP_Game);
+
+namespace POIZoneCVars
+{
+	static TAutoConsoleVariable<bool> CVarServerZones(
+		TEXT("pot.POIServerZones"),
+		true,
+		TEXT("If true, dedicated servers resolve POI membership themselves and clients do not report POI overlaps.\n"),
+		ECVF_Default);
+
+	static TAutoConsoleVariable<float> CVarUpdateInterval(
+		TEXT("pot.POIZoneUpdateInterval"),
+		0.25f,
+		TEXT("Seconds between server POI membership passes.\n"),
+		ECVF_Default);
+
+	static TAutoConsoleVariable<int32> CVarDebouncePasses(
+		TEXT("pot.POIZoneDebouncePasses"),
+		2,
+		TEXT("Number of consecutive passes a character must be inside or outside a POI before it is entered or exited.\n"),
+		ECVF_Default);
+}
+
+bool FPOIZoneShape::Contains(const FVector& Location) const
+{
+	if (Location.Z < MinZ || Location.Z > MaxZ)
+	{
+		return false;
+	}
+
+	const FVector2D Point(Location);
+	if (!Bounds.IsInside(Point))
+	{
+		return false;
+	}
+
+	for (int32 Index = 0; Index < Hull.Num(); Index++)
+	{
+		const FVector2D& EdgeStart = Hull[Index];
+		const FVector2D& EdgeEnd = Hull[(Index + 1) % Hull.Num()];
+
+		if (FVector2D::CrossProduct(EdgeEnd - EdgeStart, Point - EdgeStart) < 0.f)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+bool FPOIZone::Contains(const FVector& Location) const
+{
+	if (!Bounds.IsInside(FVector2D(Location)))
+	{
+		return false;
+	}
+
+	for (const FPOIZoneShape& Shape : Shapes)
+	{
+		if (Shape.Contains(Location))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+bool FPOIZoneGrid::IsServerAuthoritative()
+{
+	return POIZoneCVars::CVarServerZones.GetValueOnAnyThread();
+}
+
+float FPOIZoneGrid::GetUpdateInterval()
+{
+	return FMath::Max(POIZoneCVars::CVarUpdateInterval.GetValueOnGameThread(), 0.05f);
+}
+
+void FPOIZoneGrid::Build(const TArray<AIPOI*>& POIs)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FPOIZoneGrid::Build"))
+
+	Reset();
+	Zones.Reserve(POIs.Num());
+
+	for (AIPOI* POI : POIs)
+	{
+		if (!POI || POI->IsDisabled())
+		{
+			continue;
+		}
+
+		FPOIZone NewZone;
+		if (!BakeZone(POI, NewZone))
+		{
+			continue;
+		}
+
+		NewZone.POI = POI;
+
+		const int32 ZoneIndex = Zones.Add(MoveTemp(NewZone));
+		const FBox2D& ZoneBounds = Zones[ZoneIndex].Bounds;
+		const FIntPoint MinCell = GetCell(ZoneBounds.Min);
+		const FIntPoint MaxCell = GetCell(ZoneBounds.Max);
+
+		for (int32 CellX = MinCell.X; CellX <= MaxCell.X; CellX++)
+		{
+			for (int32 CellY = MinCell.Y; CellY <= MaxCell.Y; CellY++)
+			{
+				Cells.FindOrAdd(FIntPoint(CellX, CellY)).Add(ZoneIndex);
+			}
+		}
+	}
+}
+
+void FPOIZoneGrid::Reset()
+{
+	Zones.Empty();
+	Cells.Empty();
+	Memberships.Empty();
+}
+
+void FPOIZoneGrid::UpdateMembership(const TArray<AIBaseCharacter*>& Characters)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FPOIZoneGrid::UpdateMembership"))
+	SCOPE_CYCLE_COUNTER(STAT_POIZoneMembership);
+
+	const uint8 DebouncePasses = (uint8)FMath::Clamp(POIZoneCVars::CVarDebouncePasses.GetValueOnGameThread(), 1, 255);
+
+	struct FPOIZoneEvent
+	{
+		TWeakObjectPtr<AIPOI> POI;
+		TWeakObjectPtr<AIBaseCharacter> Character;
+	};
+
+	TArray<FPOIZoneEvent> Exits;
+	TArray<FPOIZoneEvent> Enters;
+
+	for (auto It = Memberships.CreateIterator(); It; ++It)
+	{
+		if (!It.Key().IsValid())
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	TArray<int32, TInlineAllocator<4>> InsideZones;
+
+	for (AIBaseCharacter* Character : Characters)
+	{
+		// Membership is held while dead, the POI handlers ignore dead characters anyway
+		if (!Character || !Character->IsAlive())
+		{
+			continue;
+		}
+
+		InsideZones.Reset();
+		GatherZonesAt(Character->GetActorLocation(), InsideZones);
+
+		TArray<FPOIZoneMembership>* FoundMemberships = Memberships.Find(Character);
+		if (!FoundMemberships)
+		{
+			if (InsideZones.Num() == 0)
+			{
+				continue;
+			}
+
+			FoundMemberships = &Memberships.Add(Character);
+		}
+
+		TArray<FPOIZoneMembership>& CharacterMemberships = *FoundMemberships;
+
+		for (const int32 ZoneIndex : InsideZones)
+		{
+			if (!CharacterMemberships.ContainsByPredicate([ZoneIndex](const FPOIZoneMembership& Membership) { return Membership.ZoneIndex == ZoneIndex; }))
+			{
+				FPOIZoneMembership& NewMembership = CharacterMemberships.AddDefaulted_GetRef();
+				NewMembership.ZoneIndex = ZoneIndex;
+			}
+		}
+
+		for (int32 Index = CharacterMemberships.Num() - 1; Index >= 0; Index--)
+		{
+			FPOIZoneMembership& Membership = CharacterMemberships[Index];
+			const bool bObservedInside = InsideZones.Contains(Membership.ZoneIndex);
+
+			if (bObservedInside == Membership.bInside)
+			{
+				Membership.PendingPasses = 0;
+			}
+			else if (++Membership.PendingPasses >= DebouncePasses)
+			{
+				Membership.bInside = bObservedInside;
+				Membership.PendingPasses = 0;
+
+				TArray<FPOIZoneEvent>& Events = bObservedInside ? Enters : Exits;
+				Events.Add({ Zones[Membership.ZoneIndex].POI, Character });
+			}
+
+			if (!Membership.bInside && Membership.PendingPasses == 0)
+			{
+				CharacterMemberships.RemoveAtSwap(Index, 1, false);
+			}
+		}
+
+		if (CharacterMemberships.Num() == 0)
+		{
+			Memberships.Remove(Character);
+		}
+	}
+
+	// Exits go first so that moving between touching POIs leaves the character in the new location
+	for (const FPOIZoneEvent& Exit : Exits)
+	{
+		if (AIPOI* POI = Exit.POI.Get())
+		{
+			if (AIBaseCharacter* Character = Exit.Character.Get())
+			{
+				POI->PointOverlapEndServer(POI, Character);
+			}
+		}
+	}
+
+	for (const FPOIZoneEvent& Enter : Enters)
+	{
+		if (AIPOI* POI = Enter.POI.Get())
+		{
+			if (AIBaseCharacter* Character = Enter.Character.Get())
+			{
+				POI->PointOverlapBeginServer(POI, Character);
+			}
+		}
+	}
+}
+
+FIntPoint FPOIZoneGrid::GetCell(const FVector2D& Location) const
+{
+	return FIntPoint(FMath::FloorToInt(Location.X / CellSize), FMath::FloorToInt(Location.Y / CellSize));
+}
+
+void FPOIZoneGrid::GatherZonesAt(const FVector& Location, TArray<int32, TInlineAllocator<4>>& OutZones) const
+{
+	const TArray<int32>* CellZones = Cells.Find(GetCell(FVector2D(Location)));
+	if (!CellZones)
+	{
+		return;
+	}
+
+	for (const int32 ZoneIndex : *CellZones)
+	{
+		if (Zones[ZoneIndex].Contains(Location))
+		{
+			OutZones.Add(ZoneIndex);
+		}
+	}
+}
+
+bool FPOIZoneGrid::BakeZone(const AIPOI* POI, FPOIZone& OutZone)
+{
+	const UStaticMeshComponent* Mesh = POI->GetMesh();
+	if (!Mesh)
+	{
+		return false;
+	}
+
+	const FTransform& ComponentTransform = Mesh->GetComponentTransform();
+	const UStaticMesh* StaticMesh = Mesh->GetStaticMesh();
+	const UBodySetup* BodySetup = StaticMesh ? StaticMesh->GetBodySetup() : nullptr;
+
+	TArray<FVector> Points;
+
+	auto AddBoxShape = [&OutZone, &Points](const FTransform& BoxTransform, const FVector& Extent)
+	{
+		Points.Reset();
+
+		for (int32 Corner = 0; Corner < 8; Corner++)
+		{
+			const FVector LocalCorner((Corner & 1) ? Extent.X : -Extent.X, (Corner & 2) ? Extent.Y : -Extent.Y, (Corner & 4) ? Extent.Z : -Extent.Z);
+			Points.Add(BoxTransform.TransformPosition(LocalCorner));
+		}
+
+		FPOIZoneShape NewShape;
+		if (BuildShape(Points, NewShape))
+		{
+			OutZone.Shapes.Add(MoveTemp(NewShape));
+		}
+	};
+
+	if (BodySetup)
+	{
+		for (const FKConvexElem& ConvexElem : BodySetup->AggGeom.ConvexElems)
+		{
+			const FTransform ElemTransform = ConvexElem.GetTransform() * ComponentTransform;
+
+			Points.Reset(ConvexElem.VertexData.Num());
+			for (const FVector& Vertex : ConvexElem.VertexData)
+			{
+				Points.Add(ElemTransform.TransformPosition(Vertex));
+			}
+
+			FPOIZoneShape NewShape;
+			if (BuildShape(Points, NewShape))
+			{
+				OutZone.Shapes.Add(MoveTemp(NewShape));
+			}
+		}
+
+		for (const FKBoxElem& BoxElem : BodySetup->AggGeom.BoxElems)
+		{
+			AddBoxShape(BoxElem.GetTransform() * ComponentTransform, FVector(BoxElem.X, BoxElem.Y, BoxElem.Z) * 0.5f);
+		}
+	}
+
+	// Meshes without simple collision fall back to their bounds
+	if (OutZone.Shapes.Num() == 0)
+	{
+		const FBox MeshBox = Mesh->Bounds.GetBox();
+		if (!MeshBox.IsValid)
+		{
+			return false;
+		}
+
+		AddBoxShape(FTransform(MeshBox.GetCenter()), MeshBox.GetExtent());
+	}
+
+	for (const FPOIZoneShape& Shape : OutZone.Shapes)
+	{
+		OutZone.Bounds += Shape.Bounds;
+	}
+
+	return OutZone.Shapes.Num() > 0;
+}
+
+bool FPOIZoneGrid::BuildShape(TArray<FVector>& Points, FPOIZoneShape& OutShape)
+{
+	if (Points.Num() < 3)
+	{
+		return false;
+	}
+
+	OutShape.MinZ = TNumericLimits<float>::Max();
+	OutShape.MaxZ = TNumericLimits<float>::Lowest();
+
+	TArray<FVector2D> Points2D;
+	Points2D.Reserve(Points.Num());
+
+	for (const FVector& Point : Points)
+	{
+		OutShape.MinZ = FMath::Min(OutShape.MinZ, (float)Point.Z);
+		OutShape.MaxZ = FMath::Max(OutShape.MaxZ, (float)Point.Z);
+		Points2D.Add(FVector2D(Point));
+	}
+
+	Points2D.Sort([](const FVector2D& A, const FVector2D& B)
+	{
+		return A.X < B.X || (A.X == B.X && A.Y < B.Y);
+	});
+
+	// Monotone chain, lower hull then upper hull, both counter-clockwise
+	TArray<FVector2D>& Hull = OutShape.Hull;
+	Hull.Reset(Points2D.Num() + 1);
+
+	auto AddHullPoint = [&Hull](const FVector2D& Point, int32 MinHullSize)
+	{
+		while (Hull.Num() >= MinHullSize && FVector2D::CrossProduct(Hull.Last() - Hull[Hull.Num() - 2], Point - Hull[Hull.Num() - 2]) <= 0.f)
+		{
+			Hull.Pop(false);
+		}
+		Hull.Add(Point);
+	};
+
+	for (const FVector2D& Point : Points2D)
+	{
+		AddHullPoint(Point, 2);
+	}
+
+	const int32 LowerHullSize = Hull.Num() + 1;
+	for (int32 Index = Points2D.Num() - 2; Index >= 0; Index--)
+	{
+		AddHullPoint(Points2D[Index], LowerHullSize);
+	}
+
+	// Last point is the same as the first
+	Hull.Pop(false);
+
+	if (Hull.Num() < 3)
+	{
+		Hull.Reset();
+		return false;
+	}
+
+	OutShape.Bounds = FBox2D(Hull);
+	return true;
+}
@@ -111,6 +111,13 @@ const FQuat Chaos_POTU2PSphylBasis(FVector(1.0 / FMath::Sqrt(2.0), 0.0, 1.0 / FM
 
 DEFINE_LOG_CATEGORY_STATIC(LogIBaseCharacter, Log, All);
 
+DECLARE_CYCLE_STAT(TEXT("Reconcile Particles"), STAT_ReconcileParticles, STATGROUP_Game);
+DECLARE_CYCLE_STAT(TEXT("Prepare Cooldowns For Save"), STAT_PrepareCooldownsForSave, STATGROUP_Game);
+DECLARE_CYCLE_STAT(TEXT("Restore Saved Cooldowns"), STAT_RestoreSavedCooldowns, STATGROUP_Game);
+DECLARE_CYCLE_STAT(TEXT("Resolve Weapon Hit Occlusion"), STAT_ResolveWeaponHitOcclusion, STATGROUP_Game);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Weapon Hit Candidates"), STAT_WeaponHitCandidates, STATGROUP_Game);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Weapon Hits Occluded"), STAT_WeaponHitsOccluded, STATGROUP_Game);
+
 #if DEBUG_WEAPONS
 FAutoConsoleVariable CVarDebugSweeps(
 	TEXT("pot.DebugWeaponSwings"),
@@ -128,6 +135,36 @@ FAutoConsoleVariable CVarDebugWeaponColliders(
 
 #endif
 
+float GNetCullDistanceMinGrowthScale = 0.6f;
+FAutoConsoleVariableRef CVarNetCullDistanceMinGrowthScale(
+	TEXT("pot.NetCullDistanceMinGrowthScale"),
+	GNetCullDistanceMinGrowthScale,
+	TEXT("Net cull distance multiplier of a character at 0 growth, scaling up to 1 at full growth.\n")
+	TEXT(" 1: growth does not affect relevancy"),
+	ECVF_Default);
+
+int32 GGroupMembersAlwaysNetRelevant = 1;
+FAutoConsoleVariableRef CVarGroupMembersAlwaysNetRelevant(
+	TEXT("pot.GroupMembersAlwaysNetRelevant"),
+	GGroupMembersAlwaysNetRelevant,
+	TEXT("Whether characters are always relevant to the members of their group regardless of distance.\n")
+	TEXT(" 0: off, otherwise on"),
+	ECVF_Default);
+
+float GRestingNetUpdateFrequencyScale = 0.5f;
+FAutoConsoleVariableRef CVarRestingNetUpdateFrequencyScale(
+	TEXT("pot.RestingNetUpdateFrequencyScale"),
+	GRestingNetUpdateFrequencyScale,
+	TEXT("Multiplier applied to the net update frequency of resting characters."),
+	ECVF_Default);
+
+float GSleepingNetUpdateFrequencyScale = 0.25f;
+FAutoConsoleVariableRef CVarSleepingNetUpdateFrequencyScale(
+	TEXT("pot.SleepingNetUpdateFrequencyScale"),
+	GSleepingNetUpdateFrequencyScale,
+	TEXT("Multiplier applied to the net update frequency of sleeping characters."),
+	ECVF_Default);
+
 #if OLD_STATS_AND_ABILITIES
 int32 GUseGAS = 0;
 FAutoConsoleVariableRef CVarUseGAS(
@@ -165,6 +202,12 @@ AIBaseCharacter::AIBaseCharacter(const class FObjectInitializer& ObjectInitializ
 	// Enable Ticking
 	PrimaryActorTick.bCanEverTick = true;
 
+	// Quests and quest tasks are registered as they change instead of being walked every replication pass.
+	// This applies to every subclass as well: ReplicateSubobjects overrides on this actor are no longer called, so any
+	// subobject a subclass replicates must be registered through AddReplicatedSubObject. Components keep their own
+	// setting. Run with net.SubObjects.CompareWithLegacy 1 to catch subobjects that are missing from the list.
+	bReplicateUsingRegisteredSubObjectList = true;
+
 	AbilitySystem = CreateDefaultSubobject<UPOTAbilitySystemComponent>(TEXT("AbilitySystem"));
 	AbilitySystem->OnAttackAbilityStart.AddDynamic(this, &AIBaseCharacter::OnAttackAbilityStart);
 	AbilitySystem->OnAttackAbilityEnd.AddDynamic(this, &AIBaseCharacter::OnAttackAbilityEnd);
@@ -771,6 +814,15 @@ void AIBaseCharacter::GetHeadLocRot_Implementation(FVector &OutLocation, FRotato
 	OutRotation = GetActorRotation();
 }
 
+void AIBaseCharacter::PostInitProperties()
+{
+	Super::PostInitProperties();
+
+	// Set after the archetype's properties were copied in, assigning these in the constructor would leave them pointing at the class default object
+	ReplicatedDamageParticles.Owner = this;
+	ReplicatedCosmeticParticles.Owner = this;
+}
+
 void AIBaseCharacter::PostInitializeComponents()
 {
 	Super::PostInitializeComponents();
@@ -806,6 +858,12 @@ void AIBaseCharacter::PostInitializeComponents()
 				DesireSpringArmLength = ThirdPersonSpringArmComponent->TargetArmLength;
 			}
 		}
+
+		if (AbilitySystem)
+		{
+			AbilitySystem->OnActiveGameplayEffectAddedDelegateToSelf.AddUObject(this, &AIBaseCharacter::OnWetnessEffectAdded);
+			AbilitySystem->OnAnyGameplayEffectRemovedDelegate().AddUObject(this, &AIBaseCharacter::OnWetnessEffectRemoved);
+		}
 	}
 #else
 	if (IsRunningDedicatedServer())
@@ -979,6 +1037,9 @@ void AIBaseCharacter::PawnClientRestart()
 				IPlayerController->ClientClearPreviousQuestMarkers();
 			}
 
+			// Everything was cleared, so the next update has to send every marker again
+			QuestMapMarkers.Empty();
+
 			UpdateQuestMarker();
 
 			RefreshMapIcon();
@@ -2494,6 +2555,11 @@ void AIBaseCharacter::BeginPlay()
 	if (HasAuthority())
 	{
 		SetGodmode(false);
+
+		if (GetIReplicationGraph() != nullptr)
+		{
+			GetWorldTimerManager().SetTimer(TimerHandle_ReplicationGraphPolicies, this, &AIBaseCharacter::UpdateReplicationGraphPolicies, 2.f, true, 0.f);
+		}
 	}
 	if (IsLocallyControlled())
 	{
@@ -2755,6 +2821,11 @@ void AIBaseCharacter::OnRep_AttachTarget(const FAttachTarget& OldAttachTarget)
 		return;
 	}
 
+	if (HasAuthority())
+	{
+		UpdateReplicationGraphAttachDependency();
+	}
+
 	UCharacterMovementComponent* const CharMove = GetCharacterMovement();
 	USkeletalMeshComponent* const SkeleMesh = GetMesh();
 	if (CharMove == nullptr || SkeleMesh == nullptr)
@@ -3293,30 +3364,221 @@ void AIBaseCharacter::OnLatchedStaminaTagChanged(const FGameplayTag CallbackTag,
 
 bool AIBaseCharacter::IsNetRelevantFor(const AActor* RealViewer, const AActor* ViewTarget, const FVector& SrcLocation) const
 {
-	bool bParentRelevant = Super::IsNetRelevantFor(RealViewer, ViewTarget, SrcLocation);
+	// Only consulted by the legacy net driver relevancy path, see UpdateReplicationGraphPolicies for the replication graph
+	if (Super::IsNetRelevantFor(RealViewer, ViewTarget, SrcLocation))
+	{
+		return true;
+	}
+
+	// Latched and carried characters replicate together with their attach target, so they never pop in or out on their own
+	const FAttachTarget& AttachTarget = GetAttachTarget();
+	if (AttachTarget.IsValid())
+	{
+		const AActor* const AttachOwner = AttachTarget.AttachComponent->GetOwner();
+		if (AttachOwner != nullptr && (AttachOwner == ViewTarget || AttachOwner->IsWithinNetRelevancyDistance(SrcLocation)))
+		{
+			return true;
+		}
+	}
+
+	if (GGroupMembersAlwaysNetRelevant == 0)
+	{
+		return false;
+	}
+
+	const AIPlayerState* const OwnPlayerState = GetPlayerState<AIPlayerState>();
+	const AIPlayerGroupActor* const OwnGroup = OwnPlayerState != nullptr ? OwnPlayerState->GetPlayerGroupActor() : nullptr;
+	if (OwnGroup == nullptr)
+	{
+		return false;
+	}
+
+	const AController* const ViewerController = Cast<AController>(RealViewer);
+	const AIPlayerState* const ViewerPlayerState = ViewerController != nullptr ? ViewerController->GetPlayerState<AIPlayerState>() : nullptr;
+
+	return ViewerPlayerState != nullptr && ViewerPlayerState->GetPlayerGroupActor() == OwnGroup;
+}
+
+bool AIBaseCharacter::IsWithinNetRelevancyDistance(const FVector& SrcLocation) const
+{
+	return FVector::DistSquared(SrcLocation, GetActorLocation()) < GetScaledNetCullDistanceSquared();
+}
+
+float AIBaseCharacter::GetScaledNetCullDistanceSquared() const
+{
+	const float MinScale = FMath::Clamp(GNetCullDistanceMinGrowthScale, 0.f, 1.f);
+	if (MinScale >= 1.f)
+	{
+		return NetCullDistanceSquared;
+	}
+
+	const float Scale = FMath::Lerp(MinScale, 1.f, FMath::Clamp(GetGrowthPercent(), 0.f, 1.f));
+	return NetCullDistanceSquared * FMath::Square(Scale);
+}
+
+void AIBaseCharacter::UpdateStanceNetUpdateFrequency()
+{
+	// Dead characters have their frequency lowered by StopPelvisUpdate, leave it alone
+	if (!HasAuthority() || !IsAlive())
+	{
+		return;
+	}
+
+	float Scale = 1.f;
+	if (GetRestingStance() == EStanceType::Sleeping)
+	{
+		Scale = GSleepingNetUpdateFrequencyScale;
+	}
+	else if (GetRestingStance() == EStanceType::Resting)
+	{
+		Scale = GRestingNetUpdateFrequencyScale;
+	}
+	Scale = FMath::Clamp(Scale, 0.f, 1.f);
+
+	if (Scale >= 1.f)
+	{
+		if (PreRestNetUpdateFrequency <= 0.f)
+		{
+			return;
+		}
+
+		NetUpdateFrequency = PreRestNetUpdateFrequency;
+		PreRestNetUpdateFrequency = 0.f;
+	}
+	else
+	{
+		// Keep the frequency from before the first lowered stance, so going from resting to sleeping doesn't compound
+		if (PreRestNetUpdateFrequency <= 0.f)
+		{
+			PreRestNetUpdateFrequency = NetUpdateFrequency;
+		}
+
+		NetUpdateFrequency = FMath::Max(PreRestNetUpdateFrequency * Scale, MinNetUpdateFrequency);
+	}
+
+	UpdateReplicationGraphPeriod();
+
+	// Make sure the stance change itself goes out before the lower frequency kicks in
+	ForceNetUpdate();
+}
+
+UIReplicationGraph* AIBaseCharacter::GetIReplicationGraph() const
+{
+	const UNetDriver* const NetDriver = GetNetDriver();
+	return NetDriver != nullptr ? Cast<UIReplicationGraph>(NetDriver->GetReplicationDriver()) : nullptr;
+}
+
+void AIBaseCharacter::UpdateReplicationGraphAttachDependency()
+{
+	UIReplicationGraph* const IReplicationGraph = GetIReplicationGraph();
+	if (IReplicationGraph == nullptr)
+	{
+		return;
+	}
+
 	const FAttachTarget& AttachTarget = GetAttachTarget();
-	if (!bParentRelevant && AttachTarget.IsValid())
+	AActor* const NewParent = AttachTarget.IsValid() ? AttachTarget.AttachComponent->GetOwner() : nullptr;
+	AActor* const OldParent = ReplicationGraphAttachParent.Get();
+	if (NewParent == OldParent)
+	{
+		return;
+	}
+
+	// Latched and carried characters replicate whenever their attach target does, so they never pop in or out on their own
+	if (OldParent != nullptr)
+	{
+		IReplicationGraph->GlobalActorReplicationInfoMap.RemoveDependentActor(OldParent, this);
+	}
+
+	if (NewParent != nullptr)
+	{
+		IReplicationGraph->GlobalActorReplicationInfoMap.AddDependentActor(NewParent, this);
+	}
+
+	ReplicationGraphAttachParent = NewParent;
+}
+
+void AIBaseCharacter::UpdateReplicationGraphPolicies()
+{
+	UIReplicationGraph* const IReplicationGraph = GetIReplicationGraph();
+	if (IReplicationGraph == nullptr)
+	{
+		GetWorldTimerManager().ClearTimer(TimerHandle_ReplicationGraphPolicies);
+		return;
+	}
+
+	const float CullDistanceSquared = GetScaledNetCullDistanceSquared();
+	if (!FMath::IsNearlyEqual(CullDistanceSquared, ReplicationGraphCullDistanceSquared))
 	{
-		const AIBaseCharacter* ConnectionCharacter = nullptr;
+		IReplicationGraph->SetAllCullDistanceSettingsForActor(this, CullDistanceSquared);
+		ReplicationGraphCullDistanceSquared = CullDistanceSquared;
+	}
 
-		//Double check for attach targets
-		if (const AController* Ctrl = Cast<AController>(RealViewer))
+	// Depending on a group member's pawn makes this character replicate to that member's connection regardless of distance
+	TArray<TWeakObjectPtr<AActor>> GroupParents;
+	const AIPlayerState* const OwnPlayerState = GetPlayerState<AIPlayerState>();
+	const AIPlayerGroupActor* const OwnGroup = OwnPlayerState != nullptr ? OwnPlayerState->GetPlayerGroupActor() : nullptr;
+	if (GGroupMembersAlwaysNetRelevant != 0 && OwnGroup != nullptr && IsAlive())
+	{
+		for (const AIPlayerState* const GroupMember : OwnGroup->GetGroupMembers())
 		{
-			ConnectionCharacter = Ctrl->GetPawn<AIBaseCharacter>();
+			APawn* const GroupMemberPawn = GroupMember != nullptr ? GroupMember->GetPawn() : nullptr;
+			if (GroupMemberPawn != nullptr && GroupMemberPawn != this)
+			{
+				GroupParents.Add(GroupMemberPawn);
+			}
 		}
+	}
 
-		if (ConnectionCharacter == nullptr)
+	for (const TWeakObjectPtr<AActor>& OldParent : ReplicationGraphGroupParents)
+	{
+		if (OldParent.IsValid() && !GroupParents.Contains(OldParent))
 		{
-			ConnectionCharacter = Cast<AIBaseCharacter>(ViewTarget);
+			IReplicationGraph->GlobalActorReplicationInfoMap.RemoveDependentActor(OldParent.Get(), this);
 		}
+	}
 
-		if (ConnectionCharacter != nullptr)
+	for (const TWeakObjectPtr<AActor>& NewParent : GroupParents)
+	{
+		if (!ReplicationGraphGroupParents.Contains(NewParent))
 		{
-			bParentRelevant = ConnectionCharacter == AttachTarget.AttachComponent->GetOwner();
+			IReplicationGraph->GlobalActorReplicationInfoMap.AddDependentActor(NewParent.Get(), this);
 		}
 	}
 
-	return bParentRelevant;
+	ReplicationGraphGroupParents = MoveTemp(GroupParents);
+}
+
+void AIBaseCharacter::UpdateReplicationGraphPeriod()
+{
+	UIReplicationGraph* const IReplicationGraph = GetIReplicationGraph();
+	if (IReplicationGraph == nullptr)
+	{
+		return;
+	}
+
+	FGlobalActorReplicationInfo* const GlobalInfo = IReplicationGraph->GlobalActorReplicationInfoMap.Find(this);
+	if (GlobalInfo == nullptr)
+	{
+		return;
+	}
+
+	const uint32 ReplicationPeriodFrame = IReplicationGraph->GetReplicationPeriodFrameForFrequency(NetUpdateFrequency);
+	GlobalInfo->Settings.ReplicationPeriodFrame = ReplicationPeriodFrame;
+
+	// Connections copy the global settings when they first see the actor, so update the ones that already have
+	for (UNetReplicationGraphConnection* const ConnectionManager : IReplicationGraph->Connections)
+	{
+		if (ConnectionManager == nullptr)
+		{
+			continue;
+		}
+
+		if (FConnectionReplicationActorInfo* const ConnectionInfo = ConnectionManager->ActorInfoMap.Find(this))
+		{
+			ConnectionInfo->ReplicationPeriodFrame = ReplicationPeriodFrame;
+		}
+	}
 }
 
 void AIBaseCharacter::RepositionIfObstructed(AIBaseCharacter* const OldAttachCharacter, const FQuat& BaseSweepRotation, const float ZoneRadius, const float CapsuleInflationMultiplier, const bool bSkipInitialSweep)
@@ -4452,6 +4714,7 @@ void AIBaseCharacter::SetIsResting(EStanceType NewStance)
 			}
 		}
 
+		UpdateStanceNetUpdateFrequency();
 	}
 
 	OnRestingStateChanged.Broadcast(OldStance, GetRestingStance());
@@ -6372,7 +6635,7 @@ void AIBaseCharacter::EndCarrying(UObject* CarriableObject, bool bSkipEvents /*=
 
 void AIBaseCharacter::OnAttackAbilityStart(UPOTGameplayAbility* Ability, bool bCancelled)
 {
-	PreviousBoneData.Empty();
+	DamageTracePlan.ResetPreviousTransforms();
 	bAttacking = true;
 	//UE_LOG(TitansLog, Warning, TEXT("AIBaseCharacter::OnAttackAbilityStart - bAttacking = true"));
 #if UE_SERVER
@@ -7579,6 +7842,8 @@ void AIBaseCharacter::PreReplication(IRepChangedPropertyTracker& ChangedProperty
 {
 	Super::PreReplication(ChangedPropertyTracker);
 
+	UpdateQuestReplicatedSubObjects();
+
 	if (!ensureAlways(AbilitySystem))
 	{
 		return;
@@ -9799,6 +10064,9 @@ void AIBaseCharacter::OnDeath(float KillingDamage, const FPOTDamageInfo& DamageI
 
 void AIBaseCharacter::OnDeathCosmetic()
 {
+	DeregisterAllDamageParticles();
+	DeregisterAllCosmeticParticles();
+
 	//Mark character as dead
 	if (AbilitySystem != nullptr)
 	{
@@ -10842,11 +11110,13 @@ void AIBaseCharacter::OnRep_SlottedAbilityIds()
 
 void AIBaseCharacter::OnRep_SlottedAbilityAssets()
 {
+	MarkResolvedSlottedAbilitiesDirty();
 	OnAbilitySlotsChanged.Broadcast();
 }
 
 void AIBaseCharacter::OnRep_SlottedAbilityCategories()
 {
+	MarkResolvedSlottedAbilitiesDirty();
 	OnAbilitySlotsChanged.Broadcast();
 }
 
@@ -11069,6 +11339,7 @@ void AIBaseCharacter::StopPelvisUpdate()
 		// Lower Network Update Frequency
 		NetPriority = 1;
 		NetUpdateFrequency = 0.25;
+		UpdateReplicationGraphPeriod();
 	}
 }
 
@@ -11692,7 +11963,7 @@ void AIBaseCharacter::ReplicateParticle(FDamageParticleInfo DamageInfo)
 			return;
 		}
 		
-		TArray<FDamageParticleInfo>& MutableReplicatedDamageParticles = GetReplicatedDamageParticles_Mutable();
+		FReplicatedDamageParticleArray& MutableReplicatedDamageParticles = GetReplicatedDamageParticles_Mutable();
 
 		// Make sure to have at least one available 
 		const int32 MaxEffectCurrentType = FMath::Max(Session->MaximumDamageEffectsPerType.FindRef(DamageInfo.DamageEffectType), 1) ;
@@ -11707,7 +11978,7 @@ void AIBaseCharacter::ReplicateParticle(FDamageParticleInfo DamageInfo)
 		// Collect info on how many of each type exists
 		for (int32 i = 0; i < MutableReplicatedDamageParticles.Num(); i++)
 		{
-			const FDamageParticleInfo& DamageParticle = MutableReplicatedDamageParticles[i];
+			const FDamageParticleInfo& DamageParticle = MutableReplicatedDamageParticles.Items[i].Info;
 
 			if (DamageParticle.DamageEffectType == DamageInfo.DamageEffectType)
 			{
@@ -11732,10 +12003,10 @@ void AIBaseCharacter::ReplicateParticle(FDamageParticleInfo DamageInfo)
 		if (GetReplicatedDamageParticles().Num() >= MaxParticles && HighestCountParticle > 1)
 		{
 			// We have one type of effect which more than one particle, remove it.
-			MutableReplicatedDamageParticles.RemoveAt(HighestParticleCountFirstIndex);
+			MutableReplicatedDamageParticles.RemoveParticleAt(HighestParticleCountFirstIndex);
 		}
 		
-		MutableReplicatedDamageParticles.Add(DamageInfo);
+		MutableReplicatedDamageParticles.AddParticle(DamageInfo);
 	}
 }
 
@@ -11745,205 +12016,149 @@ void AIBaseCharacter::ReplicateParticle(FCosmeticParticleInfo EffectInfo)
 
 	if (GetLocalRole() == ROLE_Authority)
 	{
-		// Once additional cosmetic particles are added, optimize how the different effects are mixed (similar to what is being done for damage particles).
-		// For now, just add the effect to the array.
-		GetReplicatedCosmeticParticles_Mutable().Add(EffectInfo);
+		// Clients keep one particle component per cosmetic type, so re-applying an effect (e.g. WET) refreshes the existing item
+		GetReplicatedCosmeticParticles_Mutable().AddOrUpdateParticle(EffectInfo);
 	}
 }
-void AIBaseCharacter::StartCheckingLocalParticles()
+void FReplicatedDamageParticle::PreReplicatedRemove(const FReplicatedDamageParticleArray& InArraySerializer)
 {
-	if (!GetWorldTimerManager().IsTimerActive(TimerHandle_CheckLocalParticles))
+	if (InArraySerializer.Owner)
 	{
-		GetWorldTimerManager().SetTimer(TimerHandle_CheckLocalParticles, this, &AIBaseCharacter::CheckLocalParticles, 1.0f, true);
+		InArraySerializer.Owner->OnReplicatedDamageParticleRemoved(*this);
 	}
 }
 
-void AIBaseCharacter::StopCheckingLocalParticles()
+void FReplicatedDamageParticle::PostReplicatedAdd(const FReplicatedDamageParticleArray& InArraySerializer)
 {
-	GetWorldTimerManager().ClearTimer(TimerHandle_CheckLocalParticles);
+	if (InArraySerializer.Owner)
+	{
+		InArraySerializer.Owner->OnReplicatedDamageParticleAdded(*this);
+	}
 }
 
-void AIBaseCharacter::CheckLocalParticles()
+void FReplicatedCosmeticParticle::PreReplicatedRemove(const FReplicatedCosmeticParticleArray& InArraySerializer)
 {
-#if !UE_SERVER
-	if (IsRunningDedicatedServer())
-	{
-		return;
-	}
-	
-	if (PreviewDamageParticleLoadHandle)
+	if (InArraySerializer.Owner)
 	{
-		const FPOTParticleDefinition& FXInfo = DamageEffectParticles.FindChecked(DamageEffectLoadingType);
-		if (!FXInfo.Attribute.IsValid())
-		{
-			if (FMath::IsNearlyZero(AbilitySystem->GetNumericAttribute(FXInfo.Attribute)))
-			{
-				PreviewDamageParticleLoadHandle->CancelHandle();
-			}
-		}
+		InArraySerializer.Owner->OnReplicatedCosmeticParticleRemoved(*this);
 	}
+}
 
-	//This could be more efficient. We may want to rework as more cosmetic effects are added.
-	TArray<TPair<float, float>> WetnessInfo;
-	if (AbilitySystem->WetnessEffect != nullptr)
-	{
-		FGameplayEffectQuery Query = FGameplayEffectQuery();
-		Query.EffectDefinition = AbilitySystem->WetnessEffect;
-		WetnessInfo = AbilitySystem->GetActiveEffectsTimeRemainingAndDuration(Query);
-	}
-	if (PreviewCosmeticParticleLoadHandle &&
-		CosmeticEffectLoadingType == ECosmeticEffectType::WET
-		&& WetnessInfo.IsEmpty())
+void FReplicatedCosmeticParticle::PostReplicatedAdd(const FReplicatedCosmeticParticleArray& InArraySerializer)
+{
+	if (InArraySerializer.Owner)
 	{
-		PreviewCosmeticParticleLoadHandle->CancelHandle();
+		InArraySerializer.Owner->OnReplicatedCosmeticParticleAdded(*this);
 	}
+}
 
-	if (IsAlive())
-	{
-		StartCheckingLocalParticles();
+FReplicatedDamageParticleArray& AIBaseCharacter::GetReplicatedDamageParticles_Mutable()
+{
+	MARK_PROPERTY_DIRTY_FROM_NAME(AIBaseCharacter, ReplicatedDamageParticles, this);
+	return ReplicatedDamageParticles;
+}
 
-		// Find particles that shouldn't exist before spawning a new one
-		for (int i = LocalDamageEffectParticles.Num() - 1; i >= 0; i--)
-		{
-			if (LocalDamageEffectParticles.IsValidIndex(i))
-			{
-				bool bShouldRemove = true;
-				for (const FDamageParticleInfo& ReplicatedDamageParticle: GetReplicatedDamageParticles())
-				{
-					// If hit location and damage effect type exist in both arrays then it shouldn't be removed
-					if (LocalDamageEffectParticles[i].HitLocation == ReplicatedDamageParticle.HitLocation && LocalDamageEffectParticles[i].DamageEffectType == ReplicatedDamageParticle.DamageEffectType)
-					{
-						bShouldRemove = false;
-						break;
-					}
-				}
+void AIBaseCharacter::OnReplicatedDamageParticleAdded(const FReplicatedDamageParticle& Particle)
+{
+#if !UE_SERVER
+	if (IsRunningDedicatedServer()) return;
 
-				if (bShouldRemove)
-				{
-					DeregisterDamageParticle(LocalDamageEffectParticles[i]);
-				}
-			}
-		}
+	SCOPE_CYCLE_COUNTER(STAT_ReconcileParticles);
 
-		for (int i = LocalCosmeticEffectParticles.Num() - 1; i >= 0; i--)
-		{
-			if (LocalCosmeticEffectParticles.IsValidIndex(i))
-			{
-				bool bShouldRemove = true;
-				for (const FCosmeticParticleInfo& ReplicatedCosmeticParticle : GetReplicatedCosmeticParticles())
-				{
-					// If the cosmetic effect type exist in both arrays then it shouldn't be removed
-					if (LocalCosmeticEffectParticles[i].CosmeticEffectType == ReplicatedCosmeticParticle.CosmeticEffectType)
-					{
-						bShouldRemove = false;
-						break;
-					}
-				}
+	if (IsAlive() && !LocalDamageEffectParticleIds.Contains(Particle.ParticleId))
+	{
+		LoadDamageParticle(FDamageParticleInfo(Particle.Info.DamageEffectType, Particle.Info.HitLocation, Particle.Info.HitRotation), true, Particle.ParticleId);
+	}
+#endif
+}
 
-				if (bShouldRemove)
-				{
-					DeregisterCosmeticParticle(LocalCosmeticEffectParticles[i]);
-				}
-			}
-		}
+void AIBaseCharacter::OnReplicatedDamageParticleRemoved(const FReplicatedDamageParticle& Particle)
+{
+#if !UE_SERVER
+	if (IsRunningDedicatedServer()) return;
 
-	}
-	else
+	SCOPE_CYCLE_COUNTER(STAT_ReconcileParticles);
+
+	// Cancel loading new particle if one of it's kind are trying to be removed.
+	if (PreviewDamageParticleLoadHandle.IsValid() && DamageEffectLoadingType == Particle.Info.DamageEffectType)
 	{
-		DeregisterAllDamageParticles();
-		DeregisterAllCosmeticParticles();
+		PreviewDamageParticleLoadHandle->CancelHandle();
 	}
+
+	DeregisterDamageParticleById(Particle.ParticleId);
 #endif
 }
 
-TArray<FDamageParticleInfo>& AIBaseCharacter::GetReplicatedDamageParticles_Mutable()
+FReplicatedCosmeticParticleArray& AIBaseCharacter::GetReplicatedCosmeticParticles_Mutable()
 {
-	MARK_PROPERTY_DIRTY_FROM_NAME(AIBaseCharacter, ReplicatedDamageParticles, this);
-	return ReplicatedDamageParticles;
+	MARK_PROPERTY_DIRTY_FROM_NAME(AIBaseCharacter, ReplicatedCosmeticParticles, this);
+	return ReplicatedCosmeticParticles;
 }
 
-void AIBaseCharacter::OnRep_ReplicatedDamageParticles()
+void AIBaseCharacter::OnReplicatedCosmeticParticleAdded(const FReplicatedCosmeticParticle& Particle)
 {
 #if !UE_SERVER
 	if (IsRunningDedicatedServer()) return;
 
-	CheckLocalParticles();
+	SCOPE_CYCLE_COUNTER(STAT_ReconcileParticles);
 
-	if (IsAlive())
+	if (IsAlive() && !LocalCosmeticEffectParticleIds.Contains(Particle.ParticleId))
 	{
-		// Spawn any particles that doesn't already exist.
-		for (const FDamageParticleInfo& DamageParticle : GetReplicatedDamageParticles())
-		{
-			// Already Exists
-			bool bActive = false;
+		LoadCosmeticParticle(FCosmeticParticleInfo(Particle.Info.CosmeticEffectType, Particle.Info.EffectRotation), true, Particle.ParticleId);
+	}
+#endif
+}
 
-			for (const FDamageParticleInfo& LocalDamageParticle : LocalDamageEffectParticles)
-			{
-				if (DamageParticle.HitLocation == LocalDamageParticle.HitLocation && DamageParticle.DamageEffectType == LocalDamageParticle.DamageEffectType)
-				{
-					bActive = true;
-					break;
-				}
-			}
+void AIBaseCharacter::OnReplicatedCosmeticParticleRemoved(const FReplicatedCosmeticParticle& Particle)
+{
+#if !UE_SERVER
+	if (IsRunningDedicatedServer()) return;
 
-			// If not active/doesn't exist add it to pending list.
-			if (!bActive)
-			{
-				RegisterDamageParticle(FDamageParticleInfo(DamageParticle.DamageEffectType, DamageParticle.HitLocation, DamageParticle.HitRotation));
-			}
-		}
+	SCOPE_CYCLE_COUNTER(STAT_ReconcileParticles);
+
+	// Cancel loading new particle if one of it's kind are trying to be removed.
+	if (PreviewCosmeticParticleLoadHandle.IsValid() && CosmeticEffectLoadingType == Particle.Info.CosmeticEffectType)
+	{
+		PreviewCosmeticParticleLoadHandle->CancelHandle();
 	}
+
+	DeregisterCosmeticParticleById(Particle.ParticleId);
 #endif
 }
 
-TArray<FCosmeticParticleInfo>& AIBaseCharacter::GetReplicatedCosmeticParticles_Mutable()
+void AIBaseCharacter::OnWetnessEffectAdded(UAbilitySystemComponent* Target, const FGameplayEffectSpec& SpecApplied, FActiveGameplayEffectHandle ActiveHandle)
 {
-	MARK_PROPERTY_DIRTY_FROM_NAME(AIBaseCharacter, ReplicatedCosmeticParticles, this);
-	return ReplicatedCosmeticParticles;
+	if (AbilitySystem && AbilitySystem->WetnessEffect != nullptr && SpecApplied.Def && SpecApplied.Def->GetClass() == AbilitySystem->WetnessEffect)
+	{
+		ActiveWetnessEffectCount++;
+	}
 }
 
-void AIBaseCharacter::OnRep_ReplicatedCosmeticParticles()
+void AIBaseCharacter::OnWetnessEffectRemoved(const FActiveGameplayEffect& RemovedEffect)
 {
-#if !UE_SERVER
-	if (IsRunningDedicatedServer()) return;
+	if (!AbilitySystem || AbilitySystem->WetnessEffect == nullptr || !RemovedEffect.Spec.Def || RemovedEffect.Spec.Def->GetClass() != AbilitySystem->WetnessEffect)
+	{
+		return;
+	}
 
-	CheckLocalParticles();
+	ActiveWetnessEffectCount = FMath::Max(ActiveWetnessEffectCount - 1, 0);
 
-	if (IsAlive())
+	// Stop a pending wet particle from spawning once the character has dried off
+	if (ActiveWetnessEffectCount == 0 && PreviewCosmeticParticleLoadHandle.IsValid() && CosmeticEffectLoadingType == ECosmeticEffectType::WET)
 	{
-		// Spawn any particles that doesn't already exist.
-		for (const FCosmeticParticleInfo& CosmeticParticle : GetReplicatedCosmeticParticles())
-		{
-			// Already Exists
-			bool bActive = false;
-			for (const FCosmeticParticleInfo& LocalCosmeticParticle : LocalCosmeticEffectParticles)
-			{
-				if (CosmeticParticle.CosmeticEffectType == LocalCosmeticParticle.CosmeticEffectType)
-				{
-					bActive = true;
-					break;
-				}
-			}
-
-			// If not active/doesn't exist add it to pending list.
-			if (!bActive)
-			{
-				RegisterCosmeticParticle(FCosmeticParticleInfo(CosmeticParticle.CosmeticEffectType, CosmeticParticle.EffectRotation));
-			}
-		}
+		PreviewCosmeticParticleLoadHandle->CancelHandle();
 	}
-#endif
 }
 
 void AIBaseCharacter::RemoveReplicatedDamageParticle(EDamageEffectType DamageEffectTypeToRemove)
 {
 	bool bNeedsDirtying = false;
-	for (int32 Index = GetReplicatedDamageParticles().Num() - 1; Index >= 0; --Index)
+	for (int32 Index = ReplicatedDamageParticles.Num() - 1; Index >= 0; --Index)
 	{
 		// No longer active and should be removed
-		if (GetReplicatedDamageParticles()[Index].DamageEffectType == DamageEffectTypeToRemove)
+		if (ReplicatedDamageParticles.Items[Index].Info.DamageEffectType == DamageEffectTypeToRemove)
 		{
-			ReplicatedDamageParticles.RemoveAt(Index);
+			ReplicatedDamageParticles.RemoveParticleAt(Index);
 			bNeedsDirtying = true;
 		}
 	}
@@ -11957,12 +12172,12 @@ void AIBaseCharacter::RemoveReplicatedDamageParticle(EDamageEffectType DamageEff
 void AIBaseCharacter::RemoveReplicatedCosmeticParticle(ECosmeticEffectType CosmeticEffectTypeToRemove)
 {
 	bool bNeedsDirtying = false;
-	for (int32 Index = GetReplicatedCosmeticParticles().Num() - 1; Index >= 0; --Index)
+	for (int32 Index = ReplicatedCosmeticParticles.Num() - 1; Index >= 0; --Index)
 	{
 		// No longer active and should be removed
-		if (GetReplicatedCosmeticParticles()[Index].CosmeticEffectType == CosmeticEffectTypeToRemove)
+		if (ReplicatedCosmeticParticles.Items[Index].Info.CosmeticEffectType == CosmeticEffectTypeToRemove)
 		{
-			ReplicatedCosmeticParticles.RemoveAt(Index);
+			ReplicatedCosmeticParticles.RemoveParticleAt(Index);
 			bNeedsDirtying = true;
 		}
 	}
@@ -12061,7 +12276,7 @@ void AIBaseCharacter::GetParticleLocation(const FVector& WorldPosition, FClosest
 	}
 }
 
-void AIBaseCharacter::LoadDamageParticle(FDamageParticleInfo DamageParticleInfo, bool bRegister /*= true*/)
+void AIBaseCharacter::LoadDamageParticle(FDamageParticleInfo DamageParticleInfo, bool bRegister /*= true*/, int32 ParticleId /*= INDEX_NONE*/)
 {
 	if (DamageParticleInfo.HitLocation.IsZero())
 	{
@@ -12079,12 +12294,12 @@ void AIBaseCharacter::LoadDamageParticle(FDamageParticleInfo DamageParticleInfo,
 		FStreamableManager& Streamable = UIGameplayStatics::GetStreamableManager(this);
 		PreviewDamageParticleLoadHandle = Streamable.RequestAsyncLoad(
 			SoftDamageParticle.ToSoftObjectPath(),
-			FStreamableDelegate::CreateUObject(this, &AIBaseCharacter::OnDamageParticleLoaded, DamageParticleInfo, bRegister),
+			FStreamableDelegate::CreateUObject(this, &AIBaseCharacter::OnDamageParticleLoaded, DamageParticleInfo, bRegister, ParticleId),
 			FStreamableManager::DefaultAsyncLoadPriority, false);
 	}
 }
 
-void AIBaseCharacter::LoadCosmeticParticle(FCosmeticParticleInfo CosmeticParticleInfo, bool bRegister /*= true*/)
+void AIBaseCharacter::LoadCosmeticParticle(FCosmeticParticleInfo CosmeticParticleInfo, bool bRegister /*= true*/, int32 ParticleId /*= INDEX_NONE*/)
 {
 	const TSoftObjectPtr<UFXSystemAsset> SoftCosmeticParticle = GetCosmeticParticle(CosmeticParticleInfo);
 
@@ -12097,17 +12312,23 @@ void AIBaseCharacter::LoadCosmeticParticle(FCosmeticParticleInfo CosmeticParticl
 		FStreamableManager& Streamable = UIGameplayStatics::GetStreamableManager(this);
 		PreviewCosmeticParticleLoadHandle = Streamable.RequestAsyncLoad(
 			SoftCosmeticParticle.ToSoftObjectPath(),
-			FStreamableDelegate::CreateUObject(this, &AIBaseCharacter::OnCosmeticParticleLoaded, CosmeticParticleInfo, bRegister),
+			FStreamableDelegate::CreateUObject(this, &AIBaseCharacter::OnCosmeticParticleLoaded, CosmeticParticleInfo, bRegister, ParticleId),
 			FStreamableManager::DefaultAsyncLoadPriority, false);
 	}
 }
 
-void AIBaseCharacter::OnDamageParticleLoaded(FDamageParticleInfo DamageParticleInfo, bool bRegister /*= true*/)
+void AIBaseCharacter::OnDamageParticleLoaded(FDamageParticleInfo DamageParticleInfo, bool bRegister /*= true*/, int32 ParticleId /*= INDEX_NONE*/)
 {
 	if (!IsValid(this))
 	{
 		return;
 	}
+
+	// The replicated particle may have been removed, or already spawned, while this one was loading
+	if (ParticleId != INDEX_NONE && (!GetReplicatedDamageParticles().FindById(ParticleId) || LocalDamageEffectParticleIds.Contains(ParticleId)))
+	{
+		return;
+	}
 	if (UFXSystemAsset* LoadedParticle = GetDamageParticle(DamageParticleInfo).Get())
 	{
 		if (const USkeletalMeshComponent* const Mesh3P = GetMesh())
@@ -12170,17 +12391,24 @@ void AIBaseCharacter::OnDamageParticleLoaded(FDamageParticleInfo DamageParticleI
 			if (bRegister)
 			{
 				LocalDamageEffectParticles.Add(NewDamageParticle);
+				LocalDamageEffectParticleIds.Add(ParticleId);
 			}
 		}
 	}
 }
 
-void AIBaseCharacter::OnCosmeticParticleLoaded(FCosmeticParticleInfo CosmeticParticleInfo, bool bRegister /*= true*/)
+void AIBaseCharacter::OnCosmeticParticleLoaded(FCosmeticParticleInfo CosmeticParticleInfo, bool bRegister /*= true*/, int32 ParticleId /*= INDEX_NONE*/)
 {
 	if (!IsValid(this))
 	{
 		return;
 	}
+
+	// The replicated particle may have been removed, or already spawned, while this one was loading
+	if (ParticleId != INDEX_NONE && (!GetReplicatedCosmeticParticles().FindById(ParticleId) || LocalCosmeticEffectParticleIds.Contains(ParticleId)))
+	{
+		return;
+	}
 	
 	if (UFXSystemAsset* LoadedParticle = GetCosmeticParticle(CosmeticParticleInfo).Get())
 	{
@@ -12240,6 +12468,7 @@ void AIBaseCharacter::OnCosmeticParticleLoaded(FCosmeticParticleInfo CosmeticPar
 			if (bRegister)
 			{
 				LocalCosmeticEffectParticles.Add(NewCosmeticParticle);
+				LocalCosmeticEffectParticleIds.Add(ParticleId);
 			}
 		}
 	}
@@ -12270,6 +12499,7 @@ void AIBaseCharacter::DeregisterDamageParticle(FDamageParticleInfo DamageParticl
 		if (!bDeregisterAll)
 		{
 			LocalDamageEffectParticles.RemoveAt(i);
+			LocalDamageEffectParticleIds.RemoveAt(i);
 			return;
 		}
 		
@@ -12299,6 +12529,7 @@ void AIBaseCharacter::DeregisterCosmeticParticle(FCosmeticParticleInfo CosmeticP
 			if (!bDeregisterAll)
 			{
 				LocalCosmeticEffectParticles.RemoveAt(i);
+				LocalCosmeticEffectParticleIds.RemoveAt(i);
 				return;
 			}
 			
@@ -12307,16 +12538,49 @@ void AIBaseCharacter::DeregisterCosmeticParticle(FCosmeticParticleInfo CosmeticP
 	}
 }
 
-void AIBaseCharacter::DeregisterAllDamageParticles()
+void AIBaseCharacter::DeregisterDamageParticleById(int32 ParticleId)
 {
-	for (const auto& EffectParticle : DamageEffectParticles)
+	const int32 LocalIndex = LocalDamageEffectParticleIds.Find(ParticleId);
+	if (LocalIndex == INDEX_NONE)
 	{
-		DeregisterDamageParticle(FDamageParticleInfo(EffectParticle.Key, FVector(ForceInitToZero), FRotator(ForceInitToZero)), true);
-	} 
-	
-	LocalDamageEffectParticles.Empty();
+		return;
+	}
 
-	StopCheckingLocalParticles();
+	if (UFXSystemComponent* ParticleComponent = LocalDamageEffectParticles[LocalIndex].DamageParticle)
+	{
+		ParticleComponent->DeactivateImmediate();
+	}
+
+	LocalDamageEffectParticles.RemoveAt(LocalIndex);
+	LocalDamageEffectParticleIds.RemoveAt(LocalIndex);
+}
+
+void AIBaseCharacter::DeregisterCosmeticParticleById(int32 ParticleId)
+{
+	const int32 LocalIndex = LocalCosmeticEffectParticleIds.Find(ParticleId);
+	if (LocalIndex == INDEX_NONE)
+	{
+		return;
+	}
+
+	if (UFXSystemComponent* ParticleComponent = LocalCosmeticEffectParticles[LocalIndex].CosmeticParticle)
+	{
+		ParticleComponent->DeactivateImmediate();
+	}
+
+	LocalCosmeticEffectParticles.RemoveAt(LocalIndex);
+	LocalCosmeticEffectParticleIds.RemoveAt(LocalIndex);
+}
+
+void AIBaseCharacter::DeregisterAllDamageParticles()
+{
+	for (const auto& EffectParticle : DamageEffectParticles)
+	{
+		DeregisterDamageParticle(FDamageParticleInfo(EffectParticle.Key, FVector(ForceInitToZero), FRotator(ForceInitToZero)), true);
+	} 
+	
+	LocalDamageEffectParticles.Empty();
+	LocalDamageEffectParticleIds.Empty();
 }
 
 void AIBaseCharacter::DeregisterAllCosmeticParticles()
@@ -12327,8 +12591,7 @@ void AIBaseCharacter::DeregisterAllCosmeticParticles()
 	}
 
 	LocalCosmeticEffectParticles.Empty();
-
-	StopCheckingLocalParticles();
+	LocalCosmeticEffectParticleIds.Empty();
 }
 
 bool AIBaseCharacter::CanSprint()
@@ -12925,8 +13188,8 @@ void AIBaseCharacter::DestroyCosmeticComponents()
 		GetReplicatedCosmeticParticles_Mutable().Empty();
 	}
 
-	OnRep_ReplicatedDamageParticles();
-	OnRep_ReplicatedCosmeticParticles();
+	DeregisterAllDamageParticles();
+	DeregisterAllCosmeticParticles();
 
 	ThirdPersonSpringArmComponent = nullptr;
 
@@ -13614,6 +13877,7 @@ void AIBaseCharacter::OnRep_ActiveQuests()
 		if (IsLocallyControlled())
 		{
 			UIGameplayStatics::GetIPlayerController(this)->ClientClearPreviousQuestMarkers();
+			QuestMapMarkers.Empty();
 
 			const TArray<UIQuest*>& QuestsToCheck = GetActiveQuests();
 			TArray<FQuestDescriptiveTextCooldown> TempQuestDescriptiveCooldowns = QuestDescriptiveCooldowns;
@@ -13977,21 +14241,17 @@ void AIBaseCharacter::UpdateQuestMarker()
 		if (!IsLocallyControlled()) return;
 
 		AIPlayerController* PlayerController = UIGameplayStatics::GetIPlayerController(this);
-		if (PlayerController)
-		{
-			for (const FMapMarkerInfo& QuestMapMarker : QuestMapMarkers)
-			{
-				UIGameplayStatics::GetIPlayerController(this)->ClientRemoveUserMapMarker(QuestMapMarker, true, true);
-			}
 
-			QuestMapMarkers.Empty();
-		}
-		
-		if (GetActiveQuests().Num() == 0) return;
+		// Markers this update wants shown, diffed against QuestMapMarkers below so unchanged markers are left alone
+		TMap<FQuestMapMarkerKey, FMapMarkerInfo> DesiredQuestMapMarkers;
+
 		const TArray<UIQuest*>& QuestsToCheck = GetActiveQuests();
 
 		bool bShouldStartQuestCheckAgain = false;
-		StopActiveQuestInitializationCheck();
+		if (QuestsToCheck.Num() > 0)
+		{
+			StopActiveQuestInitializationCheck();
+		}
 
 		for (UIQuest* Quest : QuestsToCheck)
 		{
@@ -14039,27 +14299,69 @@ void AIBaseCharacter::UpdateQuestMarker()
 				}
 				else
 				{
-					if (PlayerController)
+					DesiredQuestMapMarkers.Add(FQuestMapMarkerKey(Quest, IQuestBaseTask, INDEX_NONE), FMapMarkerInfo(nullptr, IQuestBaseTask->GetWorldLocation()));
+				}
+
+				const TArray<FVector_NetQuantize>& ExtraMapMarkers = IQuestBaseTask->GetExtraMapMarkers();
+				for (int32 MarkerIndex = 0; MarkerIndex < ExtraMapMarkers.Num(); MarkerIndex++)
+				{
+					const FVector& Location = ExtraMapMarkers[MarkerIndex];
+					if (Location != FVector(EForceInit::ForceInitToZero))
 					{
-						FMapMarkerInfo QuestMapMarker = FMapMarkerInfo(nullptr, IQuestBaseTask->GetWorldLocation());
-						PlayerController->ClientAddQuestMapMarker(QuestMapMarker, Quest, Quest->QuestData);
-						QuestMapMarkers.Add(QuestMapMarker);
+						DesiredQuestMapMarkers.Add(FQuestMapMarkerKey(Quest, IQuestBaseTask, MarkerIndex), FMapMarkerInfo(nullptr, Location));
 					}
 				}
+			}
+		}
 
-				
-				for (const FVector& Location : IQuestBaseTask->GetExtraMapMarkers())
+		if (PlayerController)
+		{
+			// The controller matches markers by value, so a marker is only sent or removed when no other key shows the same one
+			auto IsMarkerShown = [this](const FMapMarkerInfo& Marker)
+			{
+				for (const TPair<FQuestMapMarkerKey, FMapMarkerInfo>& ShownMarker : QuestMapMarkers)
 				{
-					if (Location != FVector(EForceInit::ForceInitToZero))
+					if (!(ShownMarker.Value != Marker))
 					{
-						if (PlayerController)
-						{ 
-							FMapMarkerInfo QuestMapMarker = FMapMarkerInfo(nullptr, Location);
-							PlayerController->ClientAddQuestMapMarker(QuestMapMarker, Quest, Quest->QuestData);
-							QuestMapMarkers.Add(QuestMapMarker);
-						}
+						return true;
 					}
 				}
+				return false;
+			};
+
+			// Remove markers that went away or moved before adding, a moved marker is re-added at its new location
+			TArray<FQuestMapMarkerKey, TInlineAllocator<8>> StaleKeys;
+			for (const TPair<FQuestMapMarkerKey, FMapMarkerInfo>& ShownMarker : QuestMapMarkers)
+			{
+				const FMapMarkerInfo* DesiredMarker = DesiredQuestMapMarkers.Find(ShownMarker.Key);
+				if (!DesiredMarker || *DesiredMarker != ShownMarker.Value)
+				{
+					StaleKeys.Add(ShownMarker.Key);
+				}
+			}
+
+			for (const FQuestMapMarkerKey& StaleKey : StaleKeys)
+			{
+				FMapMarkerInfo StaleMarker;
+				QuestMapMarkers.RemoveAndCopyValue(StaleKey, StaleMarker);
+
+				if (!IsMarkerShown(StaleMarker))
+				{
+					PlayerController->ClientRemoveUserMapMarker(StaleMarker, true, true);
+				}
+			}
+
+			for (const TPair<FQuestMapMarkerKey, FMapMarkerInfo>& DesiredMarker : DesiredQuestMapMarkers)
+			{
+				if (QuestMapMarkers.Contains(DesiredMarker.Key)) continue;
+
+				if (!IsMarkerShown(DesiredMarker.Value))
+				{
+					UIQuest* Quest = DesiredMarker.Key.Quest.Get();
+					PlayerController->ClientAddQuestMapMarker(DesiredMarker.Value, Quest, Quest->QuestData);
+				}
+
+				QuestMapMarkers.Add(DesiredMarker.Key, DesiredMarker.Value);
 			}
 		}
 
@@ -14362,30 +14664,156 @@ float AIBaseCharacter::GetJawOpenRequirementScaled(AActor* CarriedObject, float
 	return JawOpenRequirement;
 }
 
-/** Method that allows an actor to replicate sub objects on its actor channel */
-bool AIBaseCharacter::ReplicateSubobjects(UActorChannel* Channel, FOutBunch* Bunch, FReplicationFlags* RepFlags)
+void AIBaseCharacter::UpdateQuestReplicatedSubObjects()
 {
-	bool bWrite = Super::ReplicateSubobjects(Channel, Bunch, RepFlags);
-	
+	if (!bQuestReplicatedSubObjectsDirty)
+	{
+		return;
+	}
+
+	bQuestReplicatedSubObjectsDirty = false;
+
+	TArray<UObject*, TInlineAllocator<32>> DesiredSubObjects;
+
+	auto AddQuest = [&DesiredSubObjects](UIQuest* Quest)
+	{
+		// Destroyed quests and tasks already unregistered themselves, don't register them again
+		if (Quest->HasAnyFlags(RF_BeginDestroyed))
+		{
+			return;
+		}
+
+		DesiredSubObjects.AddUnique(Quest);
+
+		for (UIQuestBaseTask* QuestTask : Quest->GetQuestTasks())
+		{
+			if (IsValid(QuestTask) && !QuestTask->HasAnyFlags(RF_BeginDestroyed))
+			{
+				DesiredSubObjects.AddUnique(QuestTask);
+			}
+		}
+	};
+
 	for (UIQuest* ActiveQuest : GetActiveQuests())
 	{
-		if (IsValid(ActiveQuest) && ActiveQuest->IsValidLowLevel() && !ActiveQuest->GetPlayerGroupActor())
+		// Group quests are replicated to the group members by the group actor
+		if (IsValid(ActiveQuest) && !ActiveQuest->GetPlayerGroupActor())
 		{
-			bWrite |= Channel->ReplicateSubobject(ActiveQuest, *Bunch, *RepFlags);
-			bWrite |= ActiveQuest->ReplicateSubobjects(Channel, Bunch, RepFlags);
+			AddQuest(ActiveQuest);
 		}
 	}
 
 	for (UIQuest* UncollectedRewardQuest : GetUncollectedRewardQuests())
 	{
-		if (IsValid(UncollectedRewardQuest) && UncollectedRewardQuest->IsValidLowLevel())
+		if (IsValid(UncollectedRewardQuest))
+		{
+			AddQuest(UncollectedRewardQuest);
+		}
+	}
+
+	for (int32 Index = RegisteredQuestSubObjects.Num() - 1; Index >= 0; Index--)
+	{
+		UObject* SubObject = RegisteredQuestSubObjects[Index].GetEvenIfUnreachable();
+		if (!SubObject || !DesiredSubObjects.Contains(SubObject))
+		{
+			if (SubObject)
+			{
+				RemoveReplicatedSubObject(SubObject);
+			}
+
+			RegisteredQuestSubObjects.RemoveAtSwap(Index, 1, false);
+		}
+	}
+
+	for (UObject* SubObject : DesiredSubObjects)
+	{
+		if (!RegisteredQuestSubObjects.Contains(SubObject))
+		{
+			AddReplicatedSubObject(SubObject, COND_OwnerOnly);
+			RegisteredQuestSubObjects.Add(SubObject);
+		}
+	}
+}
+
+void AIBaseCharacter::RemoveQuestReplicatedSubObject(UObject* SubObject)
+{
+	const int32 Index = RegisteredQuestSubObjects.IndexOfByPredicate([SubObject](const TWeakObjectPtr<UObject>& RegisteredSubObject)
+	{
+		return RegisteredSubObject.GetEvenIfUnreachable() == SubObject;
+	});
+
+	if (Index != INDEX_NONE)
+	{
+		RemoveReplicatedSubObject(SubObject);
+		RegisteredQuestSubObjects.RemoveAtSwap(Index, 1, false);
+	}
+}
+
+void AIBaseCharacter::GetActiveQuestsForLocation(const FName& LocationTag, TArray<UIQuest*, TInlineAllocator<4>>& OutQuests)
+{
+	if (bQuestLocationIndexDirty)
+	{
+		RebuildQuestLocationIndex();
+	}
+
+	const TArray<TWeakObjectPtr<UIQuest>>* RoutedQuests = QuestLocationIndex.Find(LocationTag);
+	if (!RoutedQuests)
+	{
+		return;
+	}
+
+	for (const TWeakObjectPtr<UIQuest>& RoutedQuest : *RoutedQuests)
+	{
+		if (UIQuest* Quest = RoutedQuest.Get())
 		{
-			bWrite |= Channel->ReplicateSubobject(UncollectedRewardQuest, *Bunch, *RepFlags);
-			bWrite |= UncollectedRewardQuest->ReplicateSubobjects(Channel, Bunch, RepFlags);
+			OutQuests.Add(Quest);
 		}
 	}
+}
 
-	return bWrite;
+void AIBaseCharacter::RebuildQuestLocationIndex()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("AIBaseCharacter::RebuildQuestLocationIndex"))
+
+	QuestLocationIndex.Reset();
+	bQuestLocationIndexDirty = false;
+
+	for (UIQuest* ActiveQuest : GetActiveQuests())
+	{
+		if (!IsValid(ActiveQuest))
+		{
+			continue;
+		}
+
+		const UQuestData* QuestData = ActiveQuest->QuestData;
+		if (!QuestData)
+		{
+			// Quest data is still loading, try again on the next lookup
+			bQuestLocationIndexDirty = true;
+			continue;
+		}
+
+		TArray<FName, TInlineAllocator<4>> QuestLocationTags;
+
+		if (QuestData->QuestShareType == EQuestShareType::LocalWorld && QuestData->LocationTag != NAME_None)
+		{
+			QuestLocationTags.Add(QuestData->LocationTag);
+		}
+
+		for (const UIQuestBaseTask* QuestTask : ActiveQuest->GetQuestTasks())
+		{
+			const UIQuestExploreTask* ExploreTask = Cast<UIQuestExploreTask>(QuestTask);
+			if (ExploreTask && ExploreTask->Tag != NAME_None)
+			{
+				QuestLocationTags.AddUnique(ExploreTask->Tag);
+			}
+		}
+
+		for (const FName& QuestLocationTag : QuestLocationTags)
+		{
+			QuestLocationIndex.FindOrAdd(QuestLocationTag).Add(ActiveQuest);
+		}
+	}
 }
 
 void AIBaseCharacter::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
@@ -14525,11 +14953,25 @@ void AIBaseCharacter::ProcessCompletedTraceSet(const FQueuedTraceSet& TraceSet)
 
 	check(TraceSet.CharacterPtr.Get() == this);
 
-	DamagedActors.Reset(LastFramesDamagedActors.Num());
+	DamagedActors.Reset();
+
+	TArray<FPendingWeaponHit, TInlineAllocator<16>> PendingDamageHits;
 
+	// Filter and deduplicate every hit of the set first, so the occlusion traces and event data
+	// are only paid for once per target that can actually be damaged.
 	for (int32 i = 0; i < TraceSet.Items.Num(); i++)
 	{
-		bool bBlocking = ProcessDamageResultsArray(TraceSet.Items[i]);
+		bool bBlocking = GatherDamageHitResults(TraceSet.Items[i], PendingDamageHits);
+	}
+
+	if (PendingDamageHits.Num() > 0)
+	{
+		ResolvePendingDamageHitOcclusion(PendingDamageHits);
+
+		for (const FPendingWeaponHit& Hit : PendingDamageHits)
+		{
+			ApplyPendingDamageHit(Hit);
+		}
 	}
 
 	for (const TWeakObjectPtr<AActor>& ActPtr : DamagedActors)
@@ -14542,15 +14984,15 @@ void AIBaseCharacter::ProcessCompletedTraceSet(const FQueuedTraceSet& TraceSet)
 	//WARN_PERF_TIME_STATIC(1);
 }
 
-bool AIBaseCharacter::ProcessDamageResultsArray(const FQueuedTraceItem& Item)
+bool AIBaseCharacter::GatherDamageHitResults(const FQueuedTraceItem& Item, TArray<FPendingWeaponHit, TInlineAllocator<16>>& OutHits)
 {
-	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("AIBaseCharacter::ProcessDamageResultsArray"))
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("AIBaseCharacter::GatherDamageHitResults"))
 
 	bool bBlockingHit = false;
 
 	for (const FHitResult& Result : Item.OutResults)
 	{
-		bBlockingHit |= ProcessDamageHitResult(Result, Item);
+		bBlockingHit |= GatherDamageHitResult(Result, Item, OutHits);
 	}
 
 	return bBlockingHit;
@@ -14593,24 +15035,17 @@ FGameplayEventData AIBaseCharacter::GenerateEventData(const FHitResult& Result,
 	return EventData;
 }
 
-bool AIBaseCharacter::ProcessDamageHitResult(FHitResult Result, const FQueuedTraceItem& Item)
+bool AIBaseCharacter::GatherDamageHitResult(const FHitResult& Result, const FQueuedTraceItem& Item, TArray<FPendingWeaponHit, TInlineAllocator<16>>& OutHits)
 {
-	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("AIBaseCharacter::ProcessDamageHitResult"));
-
-	if (Result.MyBoneName.IsNone()) // if the hit result does not add the instigator's bone, add it to use for spikes damage.
-	{
-		Result.MyBoneName = Item.ShapeName;
-	}
-
 	AActor* HitActor = Result.GetActor();
 	UPrimitiveComponent* ResultComponent = Result.GetComponent();
 
 	if (HitActor == nullptr || ResultComponent == nullptr || ResultComponent->GetCollisionResponseToChannel(ECC_WeaponTrace) == ECR_Ignore) return false;
 
-	AIBaseCharacter* HitChar = Cast<AIBaseCharacter>(HitActor);
-	if (HitChar)
+	//We need this check in case we overlap 2 components of the same actor at once
+	if (DamagedActors.Contains(HitActor))
 	{
-		//UE_LOG(LogTemp, Log, TEXT("Processing damage between %s and %s"), *GetName(), *HitChar->GetName());
+		return false;
 	}
 
 	bool bIsFriendly = !AbilitySystem->IsHostile(HitActor) && !AbilitySystem->IsNeutral(HitActor);
@@ -14620,158 +15055,169 @@ bool AIBaseCharacter::ProcessDamageHitResult(FHitResult Result, const FQueuedTra
 		return false;
 	}
 
-	bool bHitLastFrame = LastFramesDamagedActors.Contains(HitActor);
-	if (bHitLastFrame || DamagedActors.Contains(HitActor))
+	if (LastFramesDamagedActors.Contains(HitActor))
 	{
 		//Mark this actor is already hit and skip it.
-		if (bHitLastFrame)
-		{
-			DamagedActors.AddUnique(HitActor);
-		}
+		DamagedActors.Add(HitActor);
+		return false;
+	}
 
-		//UE_LOG(LogTemp, Log, TEXT("Hit Last Frame || Damaged Already"));
+	AIBaseCharacter* HitChar = Cast<AIBaseCharacter>(HitActor);
+	if (HitChar != nullptr && !HitChar->AbilitySystem->IsAlive())
+	{
 		return false;
 	}
 
-	bool bBlockingHit = false;
+	DamagedActors.Add(HitActor);
+	INC_DWORD_STAT(STAT_WeaponHitCandidates);
 
-	//We need this check in case we overlap 2 components of the same actor at once
-	//(which shouldn't happen)
-	if (!DamagedActors.Contains(HitActor))
-	{
-		bool bBlockingBodyHit = false;
-		bBlockingHit = Result.bBlockingHit;
-		bool bHitActorIsBlocking = false;
-		bool bIsHostile = AbilitySystem->IsHostile(HitActor);
+	FPendingWeaponHit& Hit = OutHits.AddDefaulted_GetRef();
+	Hit.Result = Result;
+	Hit.HitActor = HitActor;
+	Hit.HitChar = HitChar;
+	Hit.bCheckOcclusion = CheckTraceType != ECheckTraceType::CTT_NONE && HitActor->Implements<UAbilitySystemInterface>();
 
-		if (HitChar != nullptr)
-		{
-			if (!HitChar->AbilitySystem->IsAlive())
-			{
-				return false;
-			}
+	if (Hit.Result.MyBoneName.IsNone()) // if the hit result does not add the instigator's bone, add it to use for spikes damage.
+	{
+		Hit.Result.MyBoneName = Item.ShapeName;
+	}
 
-			//bHitActorIsBlocking = TargetChar->HasMatchingGameplayTag(UWaAbilitySystemGlobals::Get().BlockBuffTag);
-			//bBlockingBodyHit = TargetChar->IsBlockingBody(Result.BoneName);
-		}
+	return Result.bBlockingHit;
+}
 
-		ReportAINoise(Result.Location);
+void AIBaseCharacter::ResolvePendingDamageHitOcclusion(TArrayView<FPendingWeaponHit> Hits)
+{
+	UWorld* World = GetWorld();
+	if (CheckTraceType == ECheckTraceType::CTT_NONE || World == nullptr)
+	{
+		return;
+	}
 
-		FGameplayEventData EventData;
-		EventData = GenerateEventData(Result, CurrentDamageConfiguration);
-		
-		bool bSomethingInterferingWithHit = false;
-		UWorld* World = GetWorld();
-		if (CheckTraceType != ECheckTraceType::CTT_NONE && World != nullptr && Result.GetActor()->Implements<UAbilitySystemInterface>())
-		{
-			FVector OwnerPoint = GetActorLocation();
-			FVector TargetPoint = Result.GetActor()->GetActorLocation();
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("AIBaseCharacter::ResolvePendingDamageHitOcclusion"))
+	SCOPE_CYCLE_COUNTER(STAT_ResolveWeaponHitOcclusion);
 
-			if (CheckTraceType == ECheckTraceType::CTT_BOUNDSCENTER)
-			{
-				OwnerPoint = GetMesh()->Bounds.Origin;
+	const bool bUseBoundsCenter = CheckTraceType == ECheckTraceType::CTT_BOUNDSCENTER;
+	const FVector OwnerPoint = bUseBoundsCenter ? GetMesh()->Bounds.Origin : GetActorLocation();
+	const FCollisionObjectQueryParams COQP(ObjectTypesToQuery);
 
-				TArray<USkeletalMeshComponent*> SkelComps;
-				Result.GetActor()->GetComponents<USkeletalMeshComponent>(SkelComps);
-				for (auto* PotentialComponent : SkelComps)
-				{
-					if (PotentialComponent)
-					{
-						TargetPoint = PotentialComponent->Bounds.Origin;
-						break;
-					}
-				}
-			}
+	for (FPendingWeaponHit& Hit : Hits)
+	{
+		if (!Hit.bCheckOcclusion)
+		{
+			continue;
+		}
 
-			FCollisionQueryParams TraceParams;
-			TraceParams.AddIgnoredActors({ this, TWeakObjectPtr<AActor>(HitActor) });
-			bool bTest = false;
-			FCollisionObjectQueryParams COQP(ObjectTypesToQuery);
-#if WITH_EDITOR
-			FHitResult HitResult1;
-			FHitResult HitResult2;
-			bSomethingInterferingWithHit = World->LineTraceSingleByObjectType(HitResult1, Result.ImpactPoint, OwnerPoint, COQP, TraceParams);
-			bTest = World->LineTraceSingleByObjectType(HitResult2, Result.TraceStart, TargetPoint, COQP, TraceParams);
-#else
-			bSomethingInterferingWithHit = World->LineTraceTestByObjectType(Result.ImpactPoint, OwnerPoint, COQP, TraceParams);
-			bTest = World->LineTraceTestByObjectType(Result.TraceStart, TargetPoint, COQP, TraceParams);
-#endif
+		FCollisionQueryParams TraceParams;
+		TraceParams.AddIgnoredActors({ this, TWeakObjectPtr<AActor>(Hit.HitActor) });
 
 #if WITH_EDITOR
-			UE_LOG(LogTemp, Log, TEXT("Interfere: %s %s"), (bSomethingInterferingWithHit ? TEXT("TRUE") : TEXT("FALSE")), (bTest ? TEXT("TRUE") : TEXT("FALSE")))
-				bSomethingInterferingWithHit = bSomethingInterferingWithHit || bTest;
-			if (bTest == true)
+		// The target side trace only contributes to the result in editor builds
+		FVector TargetPoint = Hit.HitActor->GetActorLocation();
+		if (bUseBoundsCenter)
+		{
+			if (const USkeletalMeshComponent* TargetMesh = Hit.HitActor->FindComponentByClass<USkeletalMeshComponent>())
 			{
-				//UE_LOG(LogTemp, Log, TEXT("Interferes With: %s"), *HitResult2.Actor->GetName())
+				TargetPoint = TargetMesh->Bounds.Origin;
 			}
+		}
+
+		FHitResult HitResult1;
+		FHitResult HitResult2;
+		bool bSomethingInterferingWithHit = World->LineTraceSingleByObjectType(HitResult1, Hit.Result.ImpactPoint, OwnerPoint, COQP, TraceParams);
+		bool bTest = World->LineTraceSingleByObjectType(HitResult2, Hit.Result.TraceStart, TargetPoint, COQP, TraceParams);
+
+		UE_LOG(LogTemp, Log, TEXT("Interfere: %s %s"), (bSomethingInterferingWithHit ? TEXT("TRUE") : TEXT("FALSE")), (bTest ? TEXT("TRUE") : TEXT("FALSE")))
+		Hit.bOccluded = bSomethingInterferingWithHit || bTest;
+#else
+		Hit.bOccluded = World->LineTraceTestByObjectType(Hit.Result.ImpactPoint, OwnerPoint, COQP, TraceParams);
 #endif
 
+		if (Hit.bOccluded)
+		{
+			INC_DWORD_STAT(STAT_WeaponHitsOccluded);
 		}
-		else if (IsLocallyControlled())
+	}
+}
+
+void AIBaseCharacter::ApplyPendingDamageHit(const FPendingWeaponHit& Hit)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("AIBaseCharacter::ApplyPendingDamageHit"));
+
+	const FHitResult& Result = Hit.Result;
+	AActor* HitActor = Hit.HitActor;
+
+	ReportAINoise(Result.Location);
+
+	AICritterPawn* CritterToDamage = nullptr;
+
+	if (!Hit.bCheckOcclusion && IsLocallyControlled())
+	{
+		if (AICritterPawn* CritterActor = Cast<AICritterPawn>(HitActor))
 		{
-			if (AICritterPawn* CritterActor = Cast<AICritterPawn>(HitActor))
+			if (!CritterActor->IsDead() && abs((GetActorLocation() - CritterActor->GetActorLocation()).Size()) <= 5000)
 			{
-				if (!CritterActor->IsDead() && abs((GetActorLocation() - CritterActor->GetActorLocation()).Size()) <= 5000)
-				{
-					ServerTryDamageCritter(EventData, CritterActor);
-				}
+				CritterToDamage = CritterActor;
 			}
-			else if (AIFish* FishActor = Cast<AIFish>(HitActor))
+		}
+		else if (AIFish* FishActor = Cast<AIFish>(HitActor))
+		{
+			if (ObjectExistsAndImplementsCarriable(HitActor) && ShouldSkipInteractAnimation(HitActor))
 			{
-				if (ObjectExistsAndImplementsCarriable(HitActor) && ShouldSkipInteractAnimation(HitActor))
+				UPOTGameplayAbility* CurrentAttack = AbilitySystem->GetCurrentAttackAbility();
+				//If this attack is allowed to catch carriables (most likely fish) then try to carry it.
+				// Otherwise, just kill the fish and use existing logic to make it float to the surface.
+				if (CurrentAttack->bCanCatchCarriable) 
 				{
-					UPOTGameplayAbility* CurrentAttack = AbilitySystem->GetCurrentAttackAbility();
-					//If this attack is allowed to catch carriables (most likely fish) then try to carry it.
-					// Otherwise, just kill the fish and use existing logic to make it float to the surface.
-					if (CurrentAttack->bCanCatchCarriable) 
+					if (TryCarriableObject(HitActor, true))
 					{
-						if (TryCarriableObject(HitActor, true))
+						// replicate if successful
+						if (GetLocalRole() != ROLE_Authority)
 						{
-							// replicate if successful
-							if (GetLocalRole() != ROLE_Authority)
-							{
-								ServerCarryObject(HitActor, true);
-							}
+							ServerCarryObject(HitActor, true);
 						}
 					}
-					else
-					{
-						ServerKillFish(FishActor);
-					}
+				}
+				else
+				{
+					ServerKillFish(FishActor);
 				}
 			}
 		}
+	}
 
-		if (!bSomethingInterferingWithHit)
+	// Occluded hits never need the event, so skip building the tag containers and effect context for them
+	if (!Hit.bOccluded)
+	{
+		const FGameplayEventData EventData = GenerateEventData(Result, CurrentDamageConfiguration);
+
+		if (CritterToDamage)
 		{
-			ProcessDamageEvent(EventData, CurrentDamageConfiguration);
+			ServerTryDamageCritter(EventData, CritterToDamage);
 		}
 
-		DamagedActors.AddUnique(HitActor);
+		ProcessDamageEvent(EventData, CurrentDamageConfiguration);
+	}
 
-		if (CurrentDamageConfiguration.bDisableBodyOnHit)
+	if (CurrentDamageConfiguration.bDisableBodyOnHit)
+	{
+		TArray<FBodyShapes> Shapes;
+		//GetDamageBodiesForSlotName(Item.SlotName, Shapes);
+		for (FBodyShapes& BShapes : Shapes)
 		{
-			TArray<FBodyShapes> Shapes;
-			//GetDamageBodiesForSlotName(Item.SlotName, Shapes);
-			for (FBodyShapes& BShapes : Shapes)
+			if (Result.MyBoneName == BShapes.Name)
 			{
-				if (Result.MyBoneName == BShapes.Name)
-				{
-					BShapes.bEnabled = false;
-					break;
-				}
+				BShapes.bEnabled = false;
+				break;
 			}
 		}
+	}
 
 #if DEBUG_WEAPONS
-		if (CVarDebugSweeps->GetInt() > 0)
-		{
-			DrawDebugPoint(GetWorld(), Result.ImpactPoint, 10.f, FColor::Green, false, 5.f);
-		}
-#endif
+	if (CVarDebugSweeps->GetInt() > 0)
+	{
+		DrawDebugPoint(GetWorld(), Result.ImpactPoint, 10.f, FColor::Green, false, 5.f);
 	}
-
-	return bBlockingHit;
+#endif
 }
 
 void AIBaseCharacter::ServerKillFish_Implementation(AIFish* TargetFish)
@@ -14918,20 +15364,7 @@ void AIBaseCharacter::EnableDamage(const FWeaponDamageConfiguration& DamageConfi
 	LastHitTime = 0.f;
 	DamageSweepsCounter = 0;
 
-	CurrentAttackAbility->GetTimedTraceTransforms(CurrentSectionBones);
-	if (CurrentSectionBones.Num() > 0)
-	{
-		if (CurrentSectionBones[0].LocalBones.Num() > 0)
-		{
-			checkf(CurrentSectionBones[0].LocalBones.Num() > 0,
-				TEXT("My name: %s Attacking ability: %s"),
-				*GetName(),
-				(AbilitySystem->GetCurrentAttackAbility()) ?
-				(*AbilitySystem->GetCurrentAttackAbility()->GetName()) :
-				*FString("")
-			);
-		}
-	}
+	CompileDamageTracePlan(CurrentAttackAbility);
 
 	ClearDamagedActors();
 
@@ -15043,6 +15476,7 @@ void AIBaseCharacter::InitializeCombatData()
 	CachedBodyOwnerScale = GetMesh()->GetComponentTransform().GetMaximumAxisScale();
 
 	DamageShapeMap.Empty();
+	DamageTracePlan.Reset();
 	TArray<FBodyShapes> DamageShapes;
 	TMultiMap<FName, int32> BodyNameLookupMap;
 
@@ -15238,100 +15672,185 @@ void AIBaseCharacter::DoDamageSweeps(const float DeltaTime)
 	const float CurrentMontageTime = AbilitySystem->GetMontageTimeInCurrentMove();
 	if (CurrentMontageTime == 0.0f) return;
 
-	//if (!ensureMsgf(CurrentSectionBones.Num() > 0, TEXT("CurrentSectionBones empty")))
-	//{
-		CurrentAttackAbility->GetTimedTraceTransforms(CurrentSectionBones);
-	//}
-
-	if (CurrentSectionBones.Num() == 0)
+	if (!DamageTracePlan.IsCompiledFor(CurrentAttackAbility, CurrentAttackAbility->GetTraceGroup()))
 	{
-		CurrentAttackAbility->GatherWeaponTraceData(nullptr);
+		CompileDamageTracePlan(CurrentAttackAbility);
 	}
 
-	QueueShapeTraces(GetWorld(), CurrentSectionBones, WeaponTraceParams, CurrentMontageTime, DeltaTime, true);
+	QueueShapeTraces(GetWorld(), WeaponTraceParams, CurrentMontageTime, DeltaTime, true);
 }
 
-bool AIBaseCharacter::QueueShapeTraces(UWorld* World, const TArray<FTimedTraceBoneGroup> SectionBones, const FCollisionQueryParams& TraceParams, const float CurrentMontageTime, const float DeltaTime, bool bStopOnBlock /*= true*/)
+void AIBaseCharacter::CompileDamageTracePlan(UPOTGameplayAbility* AttackAbility)
 {
-	//GEngine->AddOnScreenDebugMessage(-1, DeltaTime, FColor::Green, FString::Printf(TEXT("AIBaseCharacter::QueueShapeTraces")));
-	//UE_LOG(LogTemp, Log, TEXT("AIBaseCharacter::QueueShapeTraces"));
-	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("AIBaseCharacter::QueueShapeTraces"))
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("AIBaseCharacter::CompileDamageTracePlan"))
 
-	if (SectionBones.Num() == 0) return false;
+	DamageTracePlan.Reset();
 
-	FQueuedTraceSet TraceSet(this);
-	TraceSet.MontageTime = CurrentMontageTime;
+	if (AttackAbility == nullptr)
+	{
+		return;
+	}
 
-	FTimedTraceBoneGroup ClosestTraceBoneGroup;
-	FTimedTraceBoneGroup NextTraceBoneGroup;
+	CurrentSectionBones.Reset();
+	AttackAbility->GetTimedTraceTransforms(CurrentSectionBones);
 
-	for (int32 i = 0; i < SectionBones.Num(); i++)
+	if (CurrentSectionBones.Num() == 0)
+	{
+		AttackAbility->GatherWeaponTraceData(nullptr);
+		AttackAbility->GetTimedTraceTransforms(CurrentSectionBones);
+	}
+
+	// Gathering the damage bodies can reinitialize combat data and reset the plan, so the plan is only stamped with
+	// the ability afterwards. A plan that cannot be built is still stamped so it isn't retried every sweep.
+	USkeletalMeshComponent* DamageMesh = GetMesh();
+	TArray<FBodyShapes> Shapes;
+	const bool bCanBuildPlan = CurrentSectionBones.Num() >= 2 && DamageMesh && GetDamageBodiesForMesh(DamageMesh, Shapes);
+
+	DamageTracePlan.Ability = AttackAbility;
+	DamageTracePlan.TraceGroup = AttackAbility->GetTraceGroup();
+
+	if (!bCanBuildPlan)
 	{
-		if (SectionBones[i].MontageTime <= CurrentMontageTime)
+		return;
+	}
+
+	// Flatten every enabled shape, keeping each bone's shapes together so its pose is read once per sweep
+	for (const FBodyShapes& Body : Shapes)
+	{
+		if (!Body.bEnabled)
 		{
-			ClosestTraceBoneGroup = SectionBones[i];
+			continue;
 		}
-		else
+
+		const int32 BoneIndex = DamageMesh->GetBoneIndex(Body.Name);
+		if (BoneIndex == INDEX_NONE)
 		{
-			NextTraceBoneGroup = SectionBones[i];
-			break;
+			continue;
 		}
-	}
-
-	GEngine->AddOnScreenDebugMessage(-1, DeltaTime, FColor::Red, FString::Printf(TEXT("AIBaseCharacter::QueueShapeTraces | CurrentMontageTime %f - SectionBonesFirst: %f - SectionBonesLast: %f"), CurrentMontageTime, SectionBones[0].MontageTime, SectionBones[SectionBones.Num() - 1].MontageTime));
-
-	TArray<FBodyShapes> Shapes;
-	GetDamageBodiesForMesh(GetMesh(), Shapes);
 
-	TArray<FAlderonBoneData, TInlineAllocator<16>> NextBoneData;
+		for (int32 ShapeIndex = 0; ShapeIndex < Body.UShapes.Num() && ShapeIndex < Body.ShapeLocalTransforms.Num(); ShapeIndex++)
+		{
+			FDamageTraceShape& TraceShape = DamageTracePlan.Shapes.AddDefaulted_GetRef();
+			TraceShape.BoneName = Body.Name;
+			TraceShape.BoneIndex = BoneIndex;
+			TraceShape.LocalTransform = Body.ShapeLocalTransforms[ShapeIndex];
+			TraceShape.Shape = Body.UShapes[ShapeIndex];
+		}
+	}
 
-	for (int32 j = 0; j < Shapes.Num(); j++)
+	// A shape is traced between two timed groups only if its bone is in both of them
+	const int32 NumGroups = CurrentSectionBones.Num();
+	DamageTracePlan.GroupTimes.Reserve(NumGroups);
+	DamageTracePlan.IntervalStarts.Reserve(NumGroups);
+	for (int32 GroupIndex = 0; GroupIndex < NumGroups; GroupIndex++)
 	{
-		if (!Shapes[j].bEnabled || !AbilitySystem->IsAlive()) continue;
-		if (!ClosestTraceBoneGroup.LocalBones.Contains(Shapes[j].Name) || !NextTraceBoneGroup.LocalBones.Contains(Shapes[j].Name)) continue;
+		DamageTracePlan.GroupTimes.Add(CurrentSectionBones[GroupIndex].MontageTime);
+		DamageTracePlan.IntervalStarts.Add(DamageTracePlan.ActiveShapes.Num());
 
-		for (int32 k = 0; k < Shapes[j].Shapes.Num(); k++)
+		if (GroupIndex + 1 >= NumGroups)
 		{
-			const FTransform& ShapeLocalTransform = Shapes[j].ShapeLocalTransforms[k];
+			continue;
+		}
 
-			FTransform StartTraceTransform = ShapeLocalTransform;
-			StartTraceTransform *= GetMesh()->GetSocketTransform(Shapes[j].Name, ERelativeTransformSpace::RTS_World);
+		const TArray<FName>& ClosestBones = CurrentSectionBones[GroupIndex].LocalBones;
+		const TArray<FName>& NextBones = CurrentSectionBones[GroupIndex + 1].LocalBones;
 
-			if (PreviousBoneData.Num() > 0)
+		for (int32 ShapeIndex = 0; ShapeIndex < DamageTracePlan.Shapes.Num(); ShapeIndex++)
+		{
+			const FName& BoneName = DamageTracePlan.Shapes[ShapeIndex].BoneName;
+			if (ClosestBones.Contains(BoneName) && NextBones.Contains(BoneName))
 			{
-				for (FAlderonBoneData BoneData : PreviousBoneData)
-				{
-					if (BoneData.BoneName == Shapes[j].Name)
-					{
-						StartTraceTransform = BoneData.BoneTransform;
-						break;
-					}
-				}
+				DamageTracePlan.ActiveShapes.Add(ShapeIndex);
 			}
+		}
+	}
 
-			FTransform EndTraceTransform = ShapeLocalTransform;
-			EndTraceTransform *= GetMesh()->GetSocketTransform(Shapes[j].Name, ERelativeTransformSpace::RTS_World);
+	DamageTracePlan.PreviousTransforms.SetNum(DamageTracePlan.Shapes.Num());
+	DamageTracePlan.PreviousSweepIds.SetNumZeroed(DamageTracePlan.Shapes.Num());
+}
 
-			NextBoneData.Add(FAlderonBoneData(Shapes[j].Name, EndTraceTransform));
+bool AIBaseCharacter::QueueShapeTraces(UWorld* World, const FCollisionQueryParams& TraceParams, const float CurrentMontageTime, const float DeltaTime, bool bStopOnBlock /*= true*/)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("AIBaseCharacter::QueueShapeTraces"))
 
-			UPOTGameplayAbility* WGA = AbilitySystem->GetCurrentAttackAbility();
+	FDamageTracePlan& Plan = DamageTracePlan;
+	const int32 NumGroups = Plan.GroupTimes.Num();
+	if (NumGroups == 0) return false;
 
-			TraceSet.AddTrace(Shapes[j].Name,
-				StartTraceTransform.GetLocation(),
-				EndTraceTransform.GetLocation(),
-				EndTraceTransform.GetRotation(),
-				Shapes[j].UShapes[k],
-				TraceParams,
-				bStopOnBlock,
-				0,
-				NextTraceBoneGroup.MontageTime - CurrentMontageTime,
-				CurrentDamageConfiguration.TraceChannel,
-				WGA != nullptr ? WGA->bFriendlyFire : false);
+	// Last group at or before the current montage time; nothing is traced before the first or after the last group
+	int32 ClosestGroupIndex = INDEX_NONE;
+	while (ClosestGroupIndex + 1 < NumGroups && Plan.GroupTimes[ClosestGroupIndex + 1] <= CurrentMontageTime)
+	{
+		ClosestGroupIndex++;
+	}
 
 #if DEBUG_WEAPONS
-			DebugTraceItem(TraceSet.Items[TraceSet.Items.Num() - 1]);
+	if (CVarDebugSweeps->GetInt() > 0)
+	{
+		GEngine->AddOnScreenDebugMessage(-1, DeltaTime, FColor::Red, FString::Printf(TEXT("AIBaseCharacter::QueueShapeTraces | CurrentMontageTime %f - SectionBonesFirst: %f - SectionBonesLast: %f"), CurrentMontageTime, Plan.GroupTimes[0], Plan.GroupTimes[NumGroups - 1]));
+	}
 #endif
+
+	const uint32 LastSweepId = Plan.SweepId++;
+
+	if (ClosestGroupIndex == INDEX_NONE || ClosestGroupIndex + 1 >= NumGroups || !AbilitySystem->IsAlive())
+	{
+		return false;
+	}
+
+	const int32 FirstActive = Plan.IntervalStarts[ClosestGroupIndex];
+	const int32 LastActive = Plan.IntervalStarts[ClosestGroupIndex + 1];
+	if (FirstActive == LastActive)
+	{
+		return false;
+	}
+
+	USkeletalMeshComponent* DamageMesh = GetMesh();
+	const FTransform& ComponentToWorld = DamageMesh->GetComponentTransform();
+	const float TraceDuration = Plan.GroupTimes[ClosestGroupIndex + 1] - CurrentMontageTime;
+
+	UPOTGameplayAbility* WGA = AbilitySystem->GetCurrentAttackAbility();
+	const bool bFriendlyFire = WGA != nullptr ? WGA->bFriendlyFire : false;
+
+	FQueuedTraceSet TraceSet(this);
+	TraceSet.MontageTime = CurrentMontageTime;
+
+	int32 CachedBoneIndex = INDEX_NONE;
+	FTransform BoneTransform;
+
+	for (int32 ActiveIndex = FirstActive; ActiveIndex < LastActive; ActiveIndex++)
+	{
+		const int32 ShapeIndex = Plan.ActiveShapes[ActiveIndex];
+		const FDamageTraceShape& TraceShape = Plan.Shapes[ShapeIndex];
+
+		if (TraceShape.BoneIndex != CachedBoneIndex)
+		{
+			CachedBoneIndex = TraceShape.BoneIndex;
+			BoneTransform = DamageMesh->GetBoneTransform(CachedBoneIndex, ComponentToWorld);
 		}
+
+		const FTransform EndTraceTransform = TraceShape.LocalTransform * BoneTransform;
+		const FVector StartTraceLocation = Plan.PreviousSweepIds[ShapeIndex] == LastSweepId ?
+			Plan.PreviousTransforms[ShapeIndex].GetLocation() : EndTraceTransform.GetLocation();
+
+		Plan.PreviousTransforms[ShapeIndex] = EndTraceTransform;
+		Plan.PreviousSweepIds[ShapeIndex] = Plan.SweepId;
+
+		TraceSet.AddTrace(TraceShape.BoneName,
+			StartTraceLocation,
+			EndTraceTransform.GetLocation(),
+			EndTraceTransform.GetRotation(),
+			TraceShape.Shape,
+			TraceParams,
+			bStopOnBlock,
+			0,
+			TraceDuration,
+			CurrentDamageConfiguration.TraceChannel,
+			bFriendlyFire);
+
+#if DEBUG_WEAPONS
+		DebugTraceItem(TraceSet.Items[TraceSet.Items.Num() - 1]);
+#endif
 	}
 
 	if (TraceSet.Items.Num() > 0)
@@ -15339,8 +15858,6 @@ bool AIBaseCharacter::QueueShapeTraces(UWorld* World, const TArray<FTimedTraceBo
 		QueueTraces(TraceSet);
 	}
 
-	PreviousBoneData = NextBoneData;
-
 	return TraceSet.Items.Num() > 0;
 }
 
@@ -18032,12 +18549,15 @@ TConstArrayView<FRecentQuest> AIBaseCharacter::GetRecentFailedQuests() const
 TArray<UIQuest*>& AIBaseCharacter::GetActiveQuests_Mutable()
 {
 	MARK_PROPERTY_DIRTY_FROM_NAME(AIBaseCharacter, ActiveQuests, this);
+	MarkQuestReplicatedSubObjectsDirty();
+	MarkQuestLocationIndexDirty();
 	return ActiveQuests;
 }
 
 TArray<UIQuest*>& AIBaseCharacter::GetUncollectedRewardQuests_Mutable()
 {
 	MARK_PROPERTY_DIRTY_FROM_NAME(AIBaseCharacter, UncollectedRewardQuests, this);
+	MarkQuestReplicatedSubObjectsDirty();
 	return UncollectedRewardQuests;
 }
 
@@ -19625,11 +20145,60 @@ void AIBaseCharacter::StartAutoRecording()
 TArray<FSlottedAbilities>& AIBaseCharacter::GetSlottedAbilityAssetsArray_Mutable()
 {
 	MARK_PROPERTY_DIRTY_FROM_NAME(AIBaseCharacter, SlottedAbilityAssetsArray, this);
+	MarkResolvedSlottedAbilitiesDirty();
 	return SlottedAbilityAssetsArray;
 }
 
+const TArray<FResolvedSlottedAbility>& AIBaseCharacter::GetResolvedSlottedAbilities()
+{
+	if (!bResolvedSlottedAbilitiesDirty)
+	{
+		// An ability asset may have been unloaded since the cache was built
+		for (const FResolvedSlottedAbility& Resolved : ResolvedSlottedAbilities)
+		{
+			if (!Resolved.AbilityAsset.IsValid())
+			{
+				bResolvedSlottedAbilitiesDirty = true;
+				break;
+			}
+		}
+	}
+
+	if (bResolvedSlottedAbilitiesDirty)
+	{
+		bResolvedSlottedAbilitiesDirty = false;
+		ResolvedSlottedAbilities.Reset();
+
+		UTitanAssetManager& AssetManager = static_cast<UTitanAssetManager&>(UAssetManager::Get());
+
+		for (const FActionBarAbility& SlottedAbilityCategory : GetSlottedAbilityCategories())
+		{
+			FPrimaryAssetId SlottedAbility;
+			if (!GetAbilityForSlot(SlottedAbilityCategory, SlottedAbility) || !SlottedAbility.IsValid())
+			{
+				continue;
+			}
+
+			UPOTAbilityAsset* LoadedAbility = AssetManager.ForceLoadAbility(SlottedAbility);
+			if (!LoadedAbility)
+			{
+				continue;
+			}
+
+			FResolvedSlottedAbility& Resolved = ResolvedSlottedAbilities.AddDefaulted_GetRef();
+			Resolved.SlottedAbility = SlottedAbilityCategory;
+			Resolved.AbilityId = SlottedAbility;
+			Resolved.AbilityAsset = LoadedAbility;
+		}
+	}
+
+	return ResolvedSlottedAbilities;
+}
+
 void AIBaseCharacter::PrepareCooldownsForSave()
 {
+	SCOPE_CYCLE_COUNTER(STAT_PrepareCooldownsForSave);
+
 	if (!bHasRestoredSavedCooldowns)
 	{
 		return;
@@ -19645,36 +20214,40 @@ void AIBaseCharacter::PrepareCooldownsForSave()
 	UPOTAbilitySystemComponent* POTAbilitySystemComponent = Cast<UPOTAbilitySystemComponent>(GetAbilitySystemComponent());
 	if (!POTAbilitySystemComponent) return;
 
-	UTitanAssetManager& AssetManager = static_cast<UTitanAssetManager&>(UAssetManager::Get());
+	const FDateTime Now = FDateTime::UtcNow();
 
-	for (const FActionBarAbility& SlottedAbilityCategory : GetSlottedAbilityCategories())
+	for (const FResolvedSlottedAbility& Resolved : GetResolvedSlottedAbilities())
 	{
-		FPrimaryAssetId SlottedAbility;
-		if (GetAbilityForSlot(SlottedAbilityCategory, SlottedAbility))
+		const UPOTAbilityAsset* LoadedAbility = Resolved.AbilityAsset.Get();
+		if (!LoadedAbility)
 		{
-			UPOTAbilityAsset* LoadedAbility = AssetManager.ForceLoadAbility(SlottedAbility);
-			if (LoadedAbility)
-			{
-				float CooldownTime = POTAbilitySystemComponent->GetCooldownTimeRemaining(LoadedAbility->GrantedAbility);
-				if (CooldownTime >= 1)
-				{
-					FDateTime Now = FDateTime::UtcNow();
-					Now += FTimespan(0, 0, (int)CooldownTime);
-					int64 UnixTime = Now.ToUnixTimestamp();
-					
-					FSavedAbilityCooldown NewSavedCooldown = FSavedAbilityCooldown();
-					NewSavedCooldown.SlottedAbility = SlottedAbilityCategory;
-					NewSavedCooldown.ExpirationUnixTime = UnixTime;
-					SlottedAbilityCooldowns.Add(NewSavedCooldown);
-				}
-			}
+			continue;
+		}
+
+		const float CooldownTime = POTAbilitySystemComponent->GetCooldownTimeRemaining(LoadedAbility->GrantedAbility);
+		if (CooldownTime >= 1)
+		{
+			FSavedAbilityCooldown NewSavedCooldown = FSavedAbilityCooldown();
+			NewSavedCooldown.SlottedAbility = Resolved.SlottedAbility;
+			NewSavedCooldown.ExpirationUnixTime = (Now + FTimespan(0, 0, (int)CooldownTime)).ToUnixTimestamp();
+			SlottedAbilityCooldowns.Add(NewSavedCooldown);
 		}
 	}
+
+	// Cooldowns still waiting on their abilities to load are saved as they were
+	for (const FPendingAbilityCooldown& PendingCooldown : PendingRestoredCooldowns)
+	{
+		SlottedAbilityCooldowns.Add(PendingCooldown.SavedCooldown);
+	}
 }
 
 void AIBaseCharacter::AddCooldownsAfterLoad()
 {
+	SCOPE_CYCLE_COUNTER(STAT_RestoreSavedCooldowns);
+
 	bHasRestoredSavedCooldowns = true;
+	MarkResolvedSlottedAbilitiesDirty();
+
 	UPOTAbilitySystemComponent* POTAbilitySystemComponent = Cast<UPOTAbilitySystemComponent>(GetAbilitySystemComponent());
 	if (!POTAbilitySystemComponent) return;
 
@@ -19683,12 +20256,11 @@ void AIBaseCharacter::AddCooldownsAfterLoad()
 		return;
 	}
 
-	UTitanAssetManager& AssetManager = static_cast<UTitanAssetManager&>(UAssetManager::Get());
+	// Add 1 second to now time, because less than 1 second will be inaccurate
+	const int64 UnixTimeOneSecond = (FDateTime::UtcNow() + FTimespan(0, 0, 1)).ToUnixTimestamp();
 
-	FDateTime Now = FDateTime::UtcNow();
-	int64 UnixTimeNow = Now.ToUnixTimestamp();
-	Now += FTimespan(0, 0, 1);
-	int64 UnixTimeOneSecond = Now.ToUnixTimestamp(); // Add 1 second to now time, because less than 1 second will be inaccurate
+	PendingRestoredCooldowns.Reset();
+	TArray<FPrimaryAssetId> AbilityIds;
 
 	for (const FSavedAbilityCooldown& SavedCooldown : SlottedAbilityCooldowns)
 	{
@@ -19696,57 +20268,84 @@ void AIBaseCharacter::AddCooldownsAfterLoad()
 		{
 			continue; // Already expired
 		}
+
 		FPrimaryAssetId SlottedAbility;
-		if (GetAbilityForSlot(SavedCooldown.SlottedAbility, SlottedAbility))
+		if (GetAbilityForSlot(SavedCooldown.SlottedAbility, SlottedAbility) && SlottedAbility.IsValid())
 		{
-			UPOTAbilityAsset* LoadedAbility = AssetManager.ForceLoadAbility(SlottedAbility);
-			if (LoadedAbility)
-			{
-				float SecondsRemaining = (float)(SavedCooldown.ExpirationUnixTime - UnixTimeNow);
-				POTAbilitySystemComponent->ApplyAbilityCooldown(LoadedAbility->GrantedAbility, SecondsRemaining);
-			}
+			PendingRestoredCooldowns.Add({ SavedCooldown, SlottedAbility });
+			AbilityIds.AddUnique(SlottedAbility);
 		}
 	}
 
 	SlottedAbilityCooldowns.Empty();
 
+	if (PendingRestoredCooldowns.Num() == 0)
+	{
+		return;
+	}
+
+	// Load every ability in one batch and apply the cooldowns once they are all ready
+	UTitanAssetManager& AssetManager = static_cast<UTitanAssetManager&>(UAssetManager::Get());
+	FStreamableHandleDelegate Delegate = FStreamableHandleDelegate::CreateUObject(this, &AIBaseCharacter::AddCooldownsAfterLoad_PostLoad);
+	AssetManager.PreloadPrimaryAssetsWithHandle(AbilityIds, {}, false, Delegate);
 }
 
-void AIBaseCharacter::PrepareGameplayEffectsForSave()
+void AIBaseCharacter::AddCooldownsAfterLoad_PostLoad(TSharedPtr<FStreamableHandle> Handle)
 {
-	if (!bHasRestoredSavedEffects || !IsAlive())
+	SCOPE_CYCLE_COUNTER(STAT_RestoreSavedCooldowns);
+
+	if (PendingRestoredCooldowns.Num() == 0)
 	{
 		return;
 	}
 
-	const UPOTAbilitySystemComponent* POTAbilitySystemComponent = Cast<UPOTAbilitySystemComponent>(GetAbilitySystemComponent());
-	if (!POTAbilitySystemComponent)
+	TArray<FPendingAbilityCooldown> CooldownsToApply = MoveTemp(PendingRestoredCooldowns);
+	PendingRestoredCooldowns.Reset();
+
+	UPOTAbilitySystemComponent* POTAbilitySystemComponent = Cast<UPOTAbilitySystemComponent>(GetAbilitySystemComponent());
+	if (!POTAbilitySystemComponent || !IsAlive())
 	{
 		return;
 	}
 
-	ActiveGameplayEffects.Empty();
-
-	const TArray<FActiveGameplayEffectHandle> ActiveEffectHandles{ POTAbilitySystemComponent->GetActiveEffects(FGameplayEffectQuery()) }; //  ::MakeQuery_MatchNoOwningTags(TagsToIgnore)) };
+	UTitanAssetManager& AssetManager = static_cast<UTitanAssetManager&>(UAssetManager::Get());
+	const int64 UnixTimeNow = FDateTime::UtcNow().ToUnixTimestamp();
 
-	for (const FActiveGameplayEffectHandle ActiveEffectHandle : ActiveEffectHandles)
+	for (const FPendingAbilityCooldown& PendingCooldown : CooldownsToApply)
 	{
-		const FActiveGameplayEffect* ActiveEffect = POTAbilitySystemComponent->GetActiveGameplayEffect(ActiveEffectHandle);
-
-		if (!ActiveEffect)
+		if (PendingCooldown.SavedCooldown.ExpirationUnixTime <= UnixTimeNow)
 		{
-			continue;
+			continue; // Expired while loading
 		}
 
-		float RemainingTime = ActiveEffect->GetTimeRemaining(POTAbilitySystemComponent->GetWorld()->GetTimeSeconds());
+		UPOTAbilityAsset* LoadedAbility = UIGameInstance::GetPrimaryAssetFromHandle<UPOTAbilityAsset>(PendingCooldown.AbilityId, Handle);
+		if (!LoadedAbility)
+		{
+			LoadedAbility = AssetManager.ForceLoadAbility(PendingCooldown.AbilityId);
+		}
 
-		if (RemainingTime <= 0.f)
+		if (LoadedAbility)
 		{
-			continue;
+			const float SecondsRemaining = (float)(PendingCooldown.SavedCooldown.ExpirationUnixTime - UnixTimeNow);
+			POTAbilitySystemComponent->ApplyAbilityCooldown(LoadedAbility->GrantedAbility, SecondsRemaining);
 		}
+	}
+}
+
+void AIBaseCharacter::PrepareGameplayEffectsForSave()
+{
+	if (!bHasRestoredSavedEffects || !IsAlive())
+	{
+		return;
+	}
 
-		ActiveGameplayEffects.Add(FSavedGameplayEffectData(ActiveEffect->Spec.Def, RemainingTime));
+	const UPOTAbilitySystemComponent* POTAbilitySystemComponent = Cast<UPOTAbilitySystemComponent>(GetAbilitySystemComponent());
+	if (!POTAbilitySystemComponent)
+	{
+		return;
 	}
+
+	POTAbilitySystemComponent->SaveActiveGameplayEffects(ActiveGameplayEffects);
 }
 
 void AIBaseCharacter::AddGameplayEffectsAfterLoad()
@@ -19761,14 +20360,7 @@ void AIBaseCharacter::AddGameplayEffectsAfterLoad()
 
 	for (const FSavedGameplayEffectData& SavedEffect : ActiveGameplayEffects)
 	{
-		const FActiveGameplayEffectHandle ActiveEffectHandle = POTAbilitySystemComponent->ApplyGameplayEffectToSelf(SavedEffect.Effect, 1.f, AbilitySystem->MakeEffectContext());
-
-		if (!ActiveEffectHandle.IsValid())
-		{
-			continue;
-		}
-
-		POTAbilitySystemComponent->ModifyActiveGameplayEffectDurationByHandle(ActiveEffectHandle, SavedEffect.Duration - POTAbilitySystemComponent->GetGameplayEffectDuration(ActiveEffectHandle));
+		POTAbilitySystemComponent->ApplySavedGameplayEffect(SavedEffect);
 	}
 
 	ActiveGameplayEffects.Empty();
@@ -19777,6 +20369,7 @@ void AIBaseCharacter::AddGameplayEffectsAfterLoad()
 TArray<FActionBarAbility>& AIBaseCharacter::GetSlottedAbilityCategories_Mutable()
 {
 	MARK_PROPERTY_DIRTY_FROM_NAME(AIBaseCharacter, SlottedAbilityCategories, this);
+	MarkResolvedSlottedAbilitiesDirty();
 	return SlottedAbilityCategories;
 }
 
@@ -13,14 +13,24 @@
 #include "Online/IPlayerGroupActor.h"
 #include "Online/IGameState.h"
 #include "Quests/IMoveToQuest.h"
+#include "Quests/IQuestManager.h"
+#include "Abilities/POTAbilitySystemComponent.h"
 
 #define LOCTEXT_NAMESPACE "PathOfTitans.QuestData"
 
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Live Quests"), STAT_LiveQuests, STATGROUP_Game);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Live Quest Tasks"), STAT_LiveQuestTasks, STATGROUP_Game);
+
 UIQuest::UIQuest()
 {
 	bCompleted = false;
 	bTrack = false;
 	bFailureInbound = false;
+
+	if (!HasAnyFlags(RF_ClassDefaultObject))
+	{
+		INC_DWORD_STAT(STAT_LiveQuests);
+	}
 }
 
 UQuestData::UQuestData()
@@ -75,42 +85,36 @@ bool UIQuestPersonalStat::MeetsStartRequirements(AIBaseCharacter* QuestOwner)
 {
 	if (!QuestOwner) return false;
 
-	UAbilitySystemComponent* AbilitySystem = QuestOwner->GetAbilitySystemComponent();
-	if (AbilitySystem)
+	UPOTAbilitySystemComponent* AbilitySystem = Cast<UPOTAbilitySystemComponent>(QuestOwner->GetAbilitySystemComponent());
+	if (!AbilitySystem || !TargetAttributeValue.IsValid() || !TargetAttributeMax.IsValid())
 	{
-		if (!TargetAttributeValue.IsValid() || !TargetAttributeMax.IsValid())
-		{
-			return false;
-		}
+		return false;
+	}
 
-		float Value = AbilitySystem->GetNumericAttribute(TargetAttributeValue);
-		float MaxValue = AbilitySystem->GetNumericAttribute(TargetAttributeMax);
-		float CurrentPercentage = 0.0f;
+	// The watch is owned by this class default object and lives as long as the character, further crossings queue a survival quest check
+	// Hysteresis only re-arms the crossing callback, the requirement itself uses the exact threshold
+	if (const FPOTAttributeThresholdWatch* const StartWatch = AbilitySystem->FindAttributeThresholdWatchByOwner(this))
+	{
+		return StartWatch->bAtThreshold;
+	}
 
-		if (MaxValue <= 0) return false;
+	TWeakObjectPtr<AIBaseCharacter> WeakQuestOwner = QuestOwner;
+	FPOTAttributeThresholdCrossed OnStartCrossed = FPOTAttributeThresholdCrossed::CreateWeakLambda(QuestOwner, [WeakQuestOwner]()
+	{
+		AIBaseCharacter* const Character = WeakQuestOwner.Get();
+		AIWorldSettings* const IWorldSettings = Character ? AIWorldSettings::GetWorldSettings(Character) : nullptr;
 
-		if (Value > 0)
+		if (IWorldSettings && IWorldSettings->QuestManager)
 		{
-			CurrentPercentage = Value / MaxValue;
+			IWorldSettings->QuestManager->QueueSurvivalQuestCheck(Character);
 		}
+	});
 
-		if (CheckLessThan)
-		{
-			if (CurrentPercentage >= StartPercentage)
-			{
-				return true;
-			}
-		}
-		else
-		{
-			if (CurrentPercentage <= StartPercentage)
-			{
-				return true;
-			}
-		}
-	}
+	const EPOTAttributeThresholdDirection Direction = CheckLessThan ? EPOTAttributeThresholdDirection::Rising : EPOTAttributeThresholdDirection::Falling;
+	const int32 Handle = AbilitySystem->AddAttributeThresholdWatch(this, TargetAttributeValue, TargetAttributeMax, StartPercentage, Direction, OnStartCrossed, true);
 
-	return false;
+	const FPOTAttributeThresholdWatch* const StartWatch = AbilitySystem->FindAttributeThresholdWatch(Handle);
+	return StartWatch && StartWatch->bAtThreshold;
 }
 
 // Called on Server Authoritive Only
@@ -120,46 +124,70 @@ void UIQuestPersonalStat::Update(AIBaseCharacter* QuestOwner, UIQuest* ActiveQue
 
 	if (bCompleted) return;
 
-	// Check if the player has met the requirements to complete the quest
-	if (!bCompleted)
+	AIBaseCharacter* const StatCharacter = GetStatCharacter(QuestOwner);
+	if (!StatCharacter) return;
+
+	UPOTAbilitySystemComponent* AbilitySystem = Cast<UPOTAbilitySystemComponent>(StatCharacter->GetAbilitySystemComponent());
+	if (!AbilitySystem || !TargetAttributeValue.IsValid() || !TargetAttributeMax.IsValid())
 	{
-		UAbilitySystemComponent* AbilitySystem = QuestOwner->GetAbilitySystemComponent();
-		if (AbilitySystem)
-		{
-			if (!TargetAttributeValue.IsValid() || !TargetAttributeMax.IsValid())
-			{
-				return;
-			}
+		return;
+	}
 
-			float Value = AbilitySystem->GetNumericAttribute(TargetAttributeValue);
-			float MaxValue = AbilitySystem->GetNumericAttribute(TargetAttributeMax);
-			float CurrentPercentage = 0.0f;
+	// Completion is driven by the attribute change delegates, the tick only (re)registers the watch
+	if (CompletionWatchHandle != INDEX_NONE && CompletionWatchAbilitySystem.Get() == AbilitySystem)
+	{
+		return;
+	}
 
-			if (Value > 0 && MaxValue > 0)
-			{
-				CurrentPercentage = Value / MaxValue;
-			}
+	ReleaseCompletionWatch();
 
-			if (CheckLessThan)
-			{
-				if (CurrentPercentage <= CompletePercentage)
-				{
-					SetIsCompleted(true);
-					OnRep_Completed();
-				}
-			}
-			else
-			{
-				if (CurrentPercentage >= CompletePercentage)
-				{
-					SetIsCompleted(true);
-					OnRep_Completed();
-				}
-			}
-		}
+	const EPOTAttributeThresholdDirection Direction = CheckLessThan ? EPOTAttributeThresholdDirection::Falling : EPOTAttributeThresholdDirection::Rising;
+	CompletionWatchHandle = AbilitySystem->AddAttributeThresholdWatch(this, TargetAttributeValue, TargetAttributeMax, CompletePercentage, Direction,
+		FPOTAttributeThresholdCrossed::CreateUObject(this, &UIQuestPersonalStat::OnCompletionThresholdCrossed));
+	CompletionWatchAbilitySystem = AbilitySystem;
+
+	const FPOTAttributeThresholdWatch* const CompletionWatch = AbilitySystem->FindAttributeThresholdWatch(CompletionWatchHandle);
+	if (CompletionWatch && CompletionWatch->bAtThreshold)
+	{
+		OnCompletionThresholdCrossed();
 	}
 }
 
+void UIQuestPersonalStat::OnCompletionThresholdCrossed()
+{
+	ReleaseCompletionWatch();
+
+	if (bCompleted) return;
+
+	SetIsCompleted(true);
+	OnRep_Completed();
+}
+
+void UIQuestPersonalStat::OnQuestRemoved()
+{
+	Super::OnQuestRemoved();
+
+	ReleaseCompletionWatch();
+}
+
+void UIQuestPersonalStat::BeginDestroy()
+{
+	ReleaseCompletionWatch();
+
+	Super::BeginDestroy();
+}
+
+void UIQuestPersonalStat::ReleaseCompletionWatch()
+{
+	if (UPOTAbilitySystemComponent* const AbilitySystem = CompletionWatchAbilitySystem.Get())
+	{
+		AbilitySystem->RemoveAttributeThresholdWatch(CompletionWatchHandle);
+	}
+
+	CompletionWatchAbilitySystem.Reset();
+	CompletionWatchHandle = INDEX_NONE;
+}
+
 void UIQuestPersonalStat::SetIsCompleted(bool bNewCompleted)
 {
 	COMPARE_ASSIGN_AND_MARK_PROPERTY_DIRTY(UIQuestPersonalStat, bCompleted, bNewCompleted, this);
@@ -850,6 +878,7 @@ void UIQuest::Update(AIBaseCharacter* QuestOwner, UIQuest* ActiveQuest)
 	}
 }
 
+// Only used by owners still on the legacy subobject path, characters register quest tasks directly
 bool UIQuest::ReplicateSubobjects(UActorChannel* Channel, FOutBunch* Bunch, FReplicationFlags* RepFlags)
 {
 	bool bWrite = Super::ReplicateSubobjects(Channel, Bunch, RepFlags);
@@ -894,6 +923,7 @@ void UIQuest::SetQuestId(const FPrimaryAssetId& NewQuestId)
 TArray<UIQuestBaseTask*>& UIQuest::GetQuestTasks_Mutable()
 {
 	MARK_PROPERTY_DIRTY_FROM_NAME(UIQuest, QuestTasks, this);
+	MarkOwnerSubObjectsDirty();
 	return QuestTasks;
 }
 
@@ -901,6 +931,27 @@ void UIQuest::SetPlayerGroupActor(AIPlayerGroupActor* NewPlayerGroupActor)
 {
 	PlayerGroupActor = NewPlayerGroupActor;
 	MARK_PROPERTY_DIRTY_FROM_NAME(UIQuest, PlayerGroupActor, this);
+	MarkOwnerSubObjectsDirty();
+}
+
+void UIQuest::MarkOwnerSubObjectsDirty()
+{
+	if (AIBaseCharacter* OwnerCharacter = Cast<AIBaseCharacter>(GetOuter()))
+	{
+		OwnerCharacter->MarkQuestReplicatedSubObjectsDirty();
+		OwnerCharacter->MarkQuestLocationIndexDirty();
+	}
+	else if (const AIPlayerGroupActor* const IPlayerGroupActor = GetPlayerGroupActor())
+	{
+		// Group quests are outered to the group actor, every member indexes their locations
+		for (const AIPlayerState* const GroupMemberState : IPlayerGroupActor->GetGroupMembers())
+		{
+			if (AIBaseCharacter* const GroupMemberCharacter = GroupMemberState ? Cast<AIBaseCharacter>(GroupMemberState->GetPawn()) : nullptr)
+			{
+				GroupMemberCharacter->MarkQuestLocationIndexDirty();
+			}
+		}
+	}
 }
 
 bool UIQuest::IsTracked() const
@@ -941,6 +992,17 @@ void UIQuest::SetIsFailureInbound(bool bNewFailureInbound)
 	COMPARE_ASSIGN_AND_MARK_PROPERTY_DIRTY(UIQuest, bFailureInbound, bNewFailureInbound, this);
 }
 
+void UIQuest::OnRemovedFromActiveQuests()
+{
+	for (UIQuestBaseTask* const QuestTask : QuestTasks)
+	{
+		if (QuestTask)
+		{
+			QuestTask->OnQuestRemoved();
+		}
+	}
+}
+
 void UIQuest::OnRep_Track()
 {
 	if (GetPlayerGroupActor())
@@ -1033,6 +1095,102 @@ void UIQuest::SetIsTracked(bool bNewTracked)
 	COMPARE_ASSIGN_AND_MARK_PROPERTY_DIRTY(UIQuest, bTrack, bNewTracked, this);
 }
 
+void FGroupQuestTags::Reset()
+{
+	Members.Reset();
+	QuestTagCounts.Reset();
+}
+
+void FGroupQuestTags::AddMember(const AIBaseCharacter* Character)
+{
+	if (!Character)
+	{
+		return;
+	}
+
+	FMemberTags& NewMember = Members.AddDefaulted_GetRef();
+	NewMember.CharacterTag = Character->CharacterTag;
+	NewMember.GameplayTags = Character->CharacterTags;
+
+	if (Character->AbilitySystem)
+	{
+		FGameplayTagContainer OwnedTags;
+		Character->AbilitySystem->GetOwnedGameplayTags(OwnedTags);
+		NewMember.GameplayTags.AppendTags(OwnedTags);
+	}
+
+	NewMember.QuestTags.Reserve(Character->QuestTags.Num());
+	for (const FName& QuestTag : Character->QuestTags)
+	{
+		if (!NewMember.QuestTags.Contains(QuestTag))
+		{
+			NewMember.QuestTags.Add(QuestTag);
+			QuestTagCounts.FindOrAdd(QuestTag)++;
+		}
+	}
+}
+
+bool FGroupQuestTags::AllMembersHaveQuestTag(const FName& QuestTag) const
+{
+	if (QuestTag == NAME_None)
+	{
+		return true;
+	}
+
+	const int32* const Count = QuestTagCounts.Find(QuestTag);
+	return Count ? *Count == Members.Num() : Members.Num() == 0;
+}
+
+void FGroupQuestTags::GetSharedQuestTags(TArray<FName, TInlineAllocator<3>>& OutQuestTags) const
+{
+	OutQuestTags.Reset();
+
+	for (const TPair<FName, int32>& QuestTagCount : QuestTagCounts)
+	{
+		if (QuestTagCount.Value == Members.Num())
+		{
+			OutQuestTags.Add(QuestTagCount.Key);
+		}
+	}
+}
+
+bool FGroupQuestTags::AnyMemberMatches(const FGameplayTagContainer& RequiredTags, const TArray<FName>& RequiredQuestTags) const
+{
+	// Nobody in the group can match if a required quest tag is missing from everyone
+	for (const FName& QuestTag : RequiredQuestTags)
+	{
+		if (!QuestTagCounts.Contains(QuestTag))
+		{
+			return false;
+		}
+	}
+
+	for (const FMemberTags& Member : Members)
+	{
+		if (!RequiredTags.HasTag(Member.CharacterTag) && !Member.GameplayTags.HasAny(RequiredTags))
+		{
+			continue;
+		}
+
+		bool bMatchesQuestTags = true;
+		for (const FName& QuestTag : RequiredQuestTags)
+		{
+			if (!Member.QuestTags.Contains(QuestTag))
+			{
+				bMatchesQuestTags = false;
+				break;
+			}
+		}
+
+		if (bMatchesQuestTags)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
 void UIQuest::ComputeValidTasks(TArray<TSoftClassPtr<UIQuestBaseTask>>& OutTasks) const
 {
 	START_PERF_TIME();
@@ -1042,37 +1200,20 @@ void UIQuest::ComputeValidTasks(TArray<TSoftClassPtr<UIQuestBaseTask>>& OutTasks
 		OutTasks.Reserve(QuestData->QuestTasks.Num() + QuestData->OptionalTasks.Num());
 		OutTasks.Append(QuestData->QuestTasks);
 
-		// add suitable optional tasks 
-		for (const FOptionalTaskData& OptionalTask : QuestData->OptionalTasks)
+		if (QuestData->OptionalTasks.Num() > 0)
 		{
-			// task will not be added unless at least one dino in the group matches all conditions
+			FGroupQuestTags GroupTags;
 			for (const AIPlayerState* GroupMemberState : GetPlayerGroupActor()->GetGroupMembers())
 			{
-				if (const AIBaseCharacter* GroupMemberCharacter = Cast<AIBaseCharacter>(GroupMemberState->GetPawn()))
+				GroupTags.AddMember(Cast<AIBaseCharacter>(GroupMemberState->GetPawn()));
+			}
+
+			// add suitable optional tasks, a task will not be added unless at least one dino in the group matches all conditions
+			for (const FOptionalTaskData& OptionalTask : QuestData->OptionalTasks)
+			{
+				if (GroupTags.AnyMemberMatches(OptionalTask.RequireGameplayTags, OptionalTask.RequireQuestTags))
 				{
-					FGameplayTagContainer GroupMemberTagContainer = FGameplayTagContainer();
-					GroupMemberCharacter->AbilitySystem->GetOwnedGameplayTags(GroupMemberTagContainer);
-
-					if (!OptionalTask.RequireGameplayTags.HasTag(GroupMemberCharacter->CharacterTag) &&
-						!GroupMemberCharacter->CharacterTags.HasAny(OptionalTask.RequireGameplayTags) &&
-						!GroupMemberTagContainer.HasAny(OptionalTask.RequireGameplayTags)) 
-					{
-						continue;
-					}
-					bool bDoesGroupMemberMatchQuestTags = true;
-					for (const FName& QuestTag : OptionalTask.RequireQuestTags)
-					{
-						if (!GroupMemberCharacter->QuestTags.Contains(QuestTag))
-						{
-							bDoesGroupMemberMatchQuestTags = false;
-							break;
-						}
-					}
-					if (bDoesGroupMemberMatchQuestTags)
-					{
-						OutTasks.Add(OptionalTask.Task);
-						break;
-					}
+					OutTasks.Add(OptionalTask.Task);
 				}
 			}
 		}
@@ -1093,6 +1234,7 @@ void UIQuest::UpdateTasksForValidityOnGroupChanged()
 		// "check off" should-have tasks if QuestTasks already contains them, and if ShouldHaveTasks does not contain a QuestTask, remove it
 		if (ShouldHaveTasks.Remove(QuestTasks[i]->GetClass()) == 0)
 		{
+			QuestTasks[i]->OnQuestRemoved();
 			QuestTasks.RemoveAt(i);
 			bTasksNeedDirtying = true;
 		}
@@ -1123,11 +1265,21 @@ void UIQuest::UpdateTasksForValidityOnGroupChanged()
 	if (bTasksNeedDirtying)
 	{
 		MARK_PROPERTY_DIRTY_FROM_NAME(UIQuest, QuestTasks, this);
+		MarkOwnerSubObjectsDirty();
 	}
 }
 
 void UIQuest::BeginDestroy()
 {
+	// Unregister synchronously, the character's deferred pass can't resolve the quest anymore once it has been purged
+	if (AIBaseCharacter* OwnerCharacter = Cast<AIBaseCharacter>(GetOuter()))
+	{
+		if (!OwnerCharacter->HasAnyFlags(RF_BeginDestroyed))
+		{
+			OwnerCharacter->RemoveQuestReplicatedSubObject(this);
+		}
+	}
+
 	for (int i = 0; i < QuestTasks.Num(); i++)
 	{
 		UIQuestBaseTask* QuestTask = QuestTasks[i];
@@ -1149,6 +1301,11 @@ void UIQuest::BeginDestroy()
 	// TODO Erlite: Technically unnecessary, but not taking any chances. Check later?
 	MARK_PROPERTY_DIRTY_FROM_NAME(UIQuest, QuestTasks, this);
 
+	if (!HasAnyFlags(RF_ClassDefaultObject))
+	{
+		DEC_DWORD_STAT(STAT_LiveQuests);
+	}
+
 	Super::BeginDestroy();
 }
 
@@ -1164,50 +1321,32 @@ void UIQuestBaseTask::Setup()
 	}
 }
 
-void UIQuestFeedMember::Update(AIBaseCharacter* QuestOwner, UIQuest* ActiveQuest)
+void UIQuestBaseTask::PostInitProperties()
 {
-	if (!QuestOwner || !TargetMember) return;
+	Super::PostInitProperties();
 
-	if (bCompleted) return;
-
-	// Check if the player has met the requirements to complete the quest
-	if (!bCompleted)
+	if (!HasAnyFlags(RF_ClassDefaultObject))
 	{
-		UAbilitySystemComponent* AbilitySystem = TargetMember->GetAbilitySystemComponent();
-		if (AbilitySystem)
-		{
-			if (!TargetAttributeValue.IsValid() || !TargetAttributeMax.IsValid())
-			{
-				return;
-			}
-
-			float Value = AbilitySystem->GetNumericAttribute(TargetAttributeValue);
-			float MaxValue = AbilitySystem->GetNumericAttribute(TargetAttributeMax);
-			float CurrentPercentage = 0.0f;
+		INC_DWORD_STAT(STAT_LiveQuestTasks);
+	}
+}
 
-			if (Value > 0 && MaxValue > 0)
-			{
-				CurrentPercentage = Value / MaxValue;
-			}
+void UIQuestBaseTask::BeginDestroy()
+{
+	if (!HasAnyFlags(RF_ClassDefaultObject))
+	{
+		DEC_DWORD_STAT(STAT_LiveQuestTasks);
+	}
 
-			if (CheckLessThan)
-			{
-				if (CurrentPercentage <= CompletePercentage)
-				{
-					SetIsCompleted(true);
-					OnRep_Completed();
-				}
-			}
-			else
-			{
-				if (CurrentPercentage >= CompletePercentage)
-				{
-					SetIsCompleted(true);
-					OnRep_Completed();
-				}
-			}
+	if (AIBaseCharacter* OwnerCharacter = Cast<AIBaseCharacter>(GetOuter()))
+	{
+		if (!OwnerCharacter->HasAnyFlags(RF_BeginDestroyed))
+		{
+			OwnerCharacter->RemoveQuestReplicatedSubObject(this);
 		}
 	}
+
+	Super::BeginDestroy();
 }
 
 void UIQuestFeedMember::Setup(AIBaseCharacter* TargetCharacter)
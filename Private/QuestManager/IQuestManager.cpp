@@ -28,6 +28,8 @@
 #include "CaveSystem/IHatchlingCave.h"
 #include "CaveSystem/IPlayerCaveBase.h"
 #include "Quests/IPOI.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Async/Async.h"
 #include "Critters/ICritterPawn.h"
 #include "AlderonCritterController.h"
 #include "UI/IGameHUD.h"
@@ -117,11 +119,27 @@ void AIQuestManager::BeginPlay()
 		UGameplayStatics::GetAllActorsOfClass(GetWorld(), AIPOI::StaticClass(), POIs);
 		AllPointsOfInterest.Reserve(POIs.Num());
 
+		TArray<AIPOI*> MeshPOIs;
+		MeshPOIs.Reserve(POIs.Num());
+
 		for (int32 i = 0; i < POIs.Num(); i++)
 		{
 			if (AIPOI* POI = Cast<AIPOI>(POIs[i]))
 			{
 				AllPointsOfInterest.Add(POI);
+				MeshPOIs.Add(POI);
+			}
+		}
+
+		// POI collision is disabled on dedicated servers, membership is resolved from baked zones instead
+		if (IsRunningDedicatedServer() && FPOIZoneGrid::IsServerAuthoritative())
+		{
+			POIZoneGrid.Build(MeshPOIs);
+
+			if (POIZoneGrid.NumZones() > 0)
+			{
+				GetWorldTimerManager().SetTimer(TimerHandle_POIZoneTick, this, &AIQuestManager::POIZoneTick, FPOIZoneGrid::GetUpdateInterval(), true);
+				COMPARE_ASSIGN_AND_MARK_PROPERTY_DIRTY(AIQuestManager, bResolvingPOIZones, true, this);
 			}
 		}
 
@@ -163,6 +181,33 @@ void AIQuestManager::EndPlay(const EEndPlayReason::Type EndPlayReason)
 	{
 		SaveContributionData();
 	}
+
+	POIZoneGrid.Reset();
+}
+
+void AIQuestManager::POIZoneTick()
+{
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	TArray<AIBaseCharacter*> Characters;
+	Characters.Reserve(World->GetNumPlayerControllers());
+
+	for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
+	{
+		if (const APlayerController* PlayerController = It->Get())
+		{
+			if (AIBaseCharacter* Character = Cast<AIBaseCharacter>(PlayerController->GetPawn()))
+			{
+				Characters.Add(Character);
+			}
+		}
+	}
+
+	POIZoneGrid.UpdateMembership(Characters);
 }
 
 void AIQuestManager::LoadContributionData()
@@ -170,9 +215,29 @@ void AIQuestManager::LoadContributionData()
 	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("AIQuestManager::LoadContributionData"))
 
 	const USaveGame_QuestContributions* const QuestContributionsSave = Cast<USaveGame_QuestContributions>(UGameplayStatics::LoadGameFromSlot(GetSaveSlotName(), 0));
-	if (QuestContributionsSave && QuestContributionsSave->Version == IAlderonCommon::Get().GetFullVersion())
+	if (QuestContributionsSave)
 	{
-		GetQuestContributions_Mutable() = QuestContributionsSave->SavedQuestContributions;
+		// Saves use tagged property serialization so they stay readable across builds, only contributions to quests that no longer exist are dropped
+		if (QuestContributionsSave->Version != IAlderonCommon::Get().GetFullVersion())
+		{
+			UE_LOG(TitansQuests, Log, TEXT("AIQuestManager::LoadContributionData: Loading contributions saved by version %s"), *QuestContributionsSave->Version);
+		}
+
+		const UAssetManager& AssetManager = UAssetManager::Get();
+
+		TArray<FQuestContribution>& LoadedContributions = GetQuestContributions_Mutable();
+		LoadedContributions = QuestContributionsSave->SavedQuestContributions;
+
+		// Quest ids can only be trusted to be gone once asset discovery is done, otherwise valid contributions would be dropped and lost on the next save
+		const FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
+		if (AssetManager.HasInitialScanCompleted() && !AssetRegistryModule.Get().IsLoadingAssets())
+		{
+			LoadedContributions.RemoveAllSwap([&AssetManager](const FQuestContribution& QuestContribution)
+			{
+				return !AssetManager.GetPrimaryAssetPath(QuestContribution.QuestId).IsValid();
+			});
+		}
+
 		ActiveWaterRestorationQuestTags = QuestContributionsSave->SavedWaterRestorationQuestTags;
 		ActiveWaystoneRestoreQuestTags = QuestContributionsSave->SavedWaystoneRestoreQuestTags;
 	}
@@ -224,41 +289,99 @@ void AIQuestManager::SaveContributionData()
 
 void AIQuestManager::OnSaveContributionData(TArray<FPrimaryAssetId> QuestAssetIds)
 {
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("AIQuestManager::OnSaveContributionData"))
+
+	const UWorld* const World = GetWorld();
+	const bool bSaveSynchronously = !World || World->bIsTearingDown || !HasActorBegunPlay() || IsActorBeingDestroyed();
+
+	if (bContributionSaveInFlight && !bSaveSynchronously)
+	{
+		bContributionSavePending = true;
+		return;
+	}
+
 	USaveGame_QuestContributions* QuestContributionsSave = Cast<USaveGame_QuestContributions>(UGameplayStatics::CreateSaveGameObject(USaveGame_QuestContributions::StaticClass()));
 	QuestContributionsSave->Version = IAlderonCommon::Get().GetFullVersion();
 
-	// Reset timestamps back to 0 that have been completed to allow player time to relog in to claim their contribution.
-	TArray<FQuestContribution> RelevantQuestContributions = GetQuestContributions();
+	const TSet<FPrimaryAssetId> GroupQuestIds(QuestAssetIds);
 
-	for (int32 i = RelevantQuestContributions.Num(); i-- > 0;)
-	{
-		bool bIsGroupContribution = false;
-		FQuestContribution& QuestContribution = RelevantQuestContributions[i];
+	// Group contributions are not saved
+	TArray<FQuestContribution>& RelevantQuestContributions = QuestContributionsSave->SavedQuestContributions;
+	RelevantQuestContributions.Reserve(GetQuestContributions().Num());
 
-		for (const FPrimaryAssetId& GroupQuestId : QuestAssetIds)
+	for (const FQuestContribution& QuestContribution : GetQuestContributions())
+	{
+		if (GroupQuestIds.Contains(QuestContribution.QuestId))
 		{
-			if (QuestContribution.QuestId == GroupQuestId)
-			{
-				RelevantQuestContributions.RemoveAt(i);
-				bIsGroupContribution = true;
-				break;
-			}
+			continue;
 		}
 
-		if (bIsGroupContribution) continue;
-
-		if (QuestContribution.Timestamp != 0.0f)
+		// Reset timestamps back to 0 that have been completed to allow player time to relog in to claim their contribution.
+		FQuestContribution& SavedContribution = RelevantQuestContributions.Add_GetRef(QuestContribution);
+		if (SavedContribution.Timestamp != 0.0f)
 		{
-			QuestContribution.Timestamp = 1.0f;
+			SavedContribution.Timestamp = 1.0f;
 		}
 	}
 
-	QuestContributionsSave->SavedQuestContributions = RelevantQuestContributions;
 	QuestContributionsSave->SavedWaterRestorationQuestTags = ActiveWaterRestorationQuestTags;
 	QuestContributionsSave->SavedWaystoneRestoreQuestTags = ActiveWaystoneRestoreQuestTags;
 
 	const FString SaveSlotName = GetSaveSlotName();
-	UGameplayStatics::SaveGameToSlot(QuestContributionsSave, SaveSlotName, 0);
+
+	// The world is going away, so write before returning
+	if (bSaveSynchronously)
+	{
+		// An older asynchronous write finishing after this one would overwrite the final state
+		if (ContributionSaveTask.IsValid())
+		{
+			ContributionSaveTask.Wait();
+		}
+
+		bContributionSavePending = false;
+		UGameplayStatics::SaveGameToSlot(QuestContributionsSave, SaveSlotName, 0);
+		return;
+	}
+
+	// Serialization happens here, the file write happens on a worker thread
+	TArray<uint8> SaveData;
+	if (!UGameplayStatics::SaveGameToMemory(QuestContributionsSave, SaveData))
+	{
+		UE_LOG(TitansQuests, Warning, TEXT("AIQuestManager::OnSaveContributionData: Failed to serialize %s"), *SaveSlotName);
+		return;
+	}
+
+	bContributionSaveInFlight = true;
+	bContributionSavePending = false;
+
+	TWeakObjectPtr<AIQuestManager> WeakThis = MakeWeakObjectPtr(this);
+	ContributionSaveTask = Async(EAsyncExecution::ThreadPool, [WeakThis, SaveSlotName, SaveData = MoveTemp(SaveData)]()
+	{
+		const bool bSuccess = UGameplayStatics::SaveDataToSlot(SaveData, SaveSlotName, 0);
+
+		AsyncTask(ENamedThreads::GameThread, [WeakThis, SaveSlotName, bSuccess]()
+		{
+			if (WeakThis.IsValid())
+			{
+				WeakThis->OnContributionDataSaved(SaveSlotName, 0, bSuccess);
+			}
+		});
+	});
+}
+
+void AIQuestManager::OnContributionDataSaved(const FString& SlotName, const int32 UserIndex, bool bSuccess)
+{
+	bContributionSaveInFlight = false;
+
+	if (!bSuccess)
+	{
+		UE_LOG(TitansQuests, Warning, TEXT("AIQuestManager::OnContributionDataSaved: Failed to save %s"), *SlotName);
+	}
+
+	if (bContributionSavePending)
+	{
+		SaveContributionData();
+	}
 }
 
 FString AIQuestManager::GetSaveSlotName()
@@ -285,6 +408,20 @@ void AIQuestManager::QuestTick()
 	const AIGameState* const IGameState = UIGameplayStatics::GetIGameState(this);
 	if (!IGameState) return;
 
+	if (!PendingSurvivalQuestChecks.IsEmpty())
+	{
+		TArray<TWeakObjectPtr<AIBaseCharacter>> SurvivalQuestChecks = MoveTemp(PendingSurvivalQuestChecks);
+		PendingSurvivalQuestChecks.Reset();
+
+		for (const TWeakObjectPtr<AIBaseCharacter>& WeakCharacter : SurvivalQuestChecks)
+		{
+			if (AIBaseCharacter* const Character = WeakCharacter.Get())
+			{
+				TryAssignSurvivalQuest(Character);
+			}
+		}
+	}
+
 	//save data for completed feed group member quests to call GroupQuestResult logic on
 	AIPlayerGroupActor* FeedMemberCleanupGroupActor = nullptr;
 	UIQuest* FeedMemberQuestToCleanup = nullptr;
@@ -305,6 +442,10 @@ void AIQuestManager::QuestTick()
 			continue;
 		}
 
+		// Gathered on first use and shared by all of this character's quests
+		FGameplayTagContainer CharacterTags{};
+		bool bGatheredCharacterTags = false;
+
 		// Backwards For Loop as quests can be removed when they are completed
 		// Intentionally backwards because you can't do this forwards without
 		// invalidating the array or length
@@ -334,9 +475,11 @@ void AIQuestManager::QuestTick()
 			//fail quests if character no longer meets gameplay tag requirements
 			if (!QuestData->RequiredGameplayTags.IsEmpty())
 			{
-				FGameplayTagContainer CharacterTags{};
-				if (UAbilitySystemComponent* AbilitySystemComponent = OwningCharacter->GetAbilitySystemComponent())
+				UAbilitySystemComponent* AbilitySystemComponent = OwningCharacter->GetAbilitySystemComponent();
+				if (!bGatheredCharacterTags && AbilitySystemComponent)
 				{
+					bGatheredCharacterTags = true;
+
 					AbilitySystemComponent->GetOwnedGameplayTags(CharacterTags);
 					// certain quests should only be give to characters that can dive
 					// Ability.CanDive simply causes bAquatic to be set to true, but dinos with bAquatic == true do not necessarily have the CanDive tag
@@ -442,50 +585,64 @@ void AIQuestManager::QuestTock()
 		AIPlayerController* OwningPlayerController = Cast<AIPlayerController>(PlayerState->GetOwner());
 		if (OwningPlayerController && OwningPlayerController->IsValidLowLevel())
 		{
-			AIBaseCharacter* OwningCharacter = OwningPlayerController->GetPawn<AIBaseCharacter>();
-			if (OwningCharacter && OwningCharacter->IsValidLowLevel() && OwningCharacter->HasLeftHatchlingCave())
-			{
-				// Backwards For Loop as quests can be removed when they are completed
-				// Intentionally backwards because you can't do this forwards without
-				// invalidating the array or length
-
-				bool bHasSurvivalQuest = false;
+			TryAssignSurvivalQuest(OwningPlayerController->GetPawn<AIBaseCharacter>());
+		}
+	}
+}
 
-				for (int32 Index = OwningCharacter->GetActiveQuests().Num() - 1; Index >= 0; --Index)
-				{
-					const UIQuest* const ActiveQuest = OwningCharacter->GetActiveQuests()[Index];
-					if (ActiveQuest && ActiveQuest->IsValidLowLevel())
-					{
-						UQuestData* QuestData = ActiveQuest->QuestData;
-						if (QuestData && QuestData->IsValidLowLevel())
-						{
-							if (QuestData->QuestShareType == EQuestShareType::Survival)
-							{
-								bHasSurvivalQuest = true;
-								break;
-							}
-						}
-					}
-				}
+void AIQuestManager::TryAssignSurvivalQuest(AIBaseCharacter* OwningCharacter)
+{
+	if (!OwningCharacter || !OwningCharacter->IsValidLowLevel() || !OwningCharacter->HasLeftHatchlingCave())
+	{
+		return;
+	}
 
-				if (!bHasSurvivalQuest)
-				{
-					FQuestIDLoaded QuestDataloaded;
-					TWeakObjectPtr<AIQuestManager> WeakThis = MakeWeakObjectPtr(this);
-					TWeakObjectPtr<AIBaseCharacter> WeakOwningCharacter = MakeWeakObjectPtr(OwningCharacter);
+	// Backwards For Loop as quests can be removed when they are completed
+	// Intentionally backwards because you can't do this forwards without
+	// invalidating the array or length
 
-					QuestDataloaded.BindLambda([WeakThis, WeakOwningCharacter](FPrimaryAssetId QuestAssetId) {
-						if (WeakThis.IsValid() && WeakOwningCharacter.IsValid())
-						{
-							WeakThis->OnQuestTock(WeakOwningCharacter.Get(), QuestAssetId);
-						}
-					});
+	bool bHasSurvivalQuest = false;
 
-					GetRandomQuest(OwningCharacter, QuestDataloaded, EQuestShareType::Survival);
+	for (int32 Index = OwningCharacter->GetActiveQuests().Num() - 1; Index >= 0; --Index)
+	{
+		const UIQuest* const ActiveQuest = OwningCharacter->GetActiveQuests()[Index];
+		if (ActiveQuest && ActiveQuest->IsValidLowLevel())
+		{
+			UQuestData* QuestData = ActiveQuest->QuestData;
+			if (QuestData && QuestData->IsValidLowLevel())
+			{
+				if (QuestData->QuestShareType == EQuestShareType::Survival)
+				{
+					bHasSurvivalQuest = true;
+					break;
 				}
 			}
 		}
 	}
+
+	if (!bHasSurvivalQuest)
+	{
+		FQuestIDLoaded QuestDataloaded;
+		TWeakObjectPtr<AIQuestManager> WeakThis = MakeWeakObjectPtr(this);
+		TWeakObjectPtr<AIBaseCharacter> WeakOwningCharacter = MakeWeakObjectPtr(OwningCharacter);
+
+		QuestDataloaded.BindLambda([WeakThis, WeakOwningCharacter](FPrimaryAssetId QuestAssetId) {
+			if (WeakThis.IsValid() && WeakOwningCharacter.IsValid())
+			{
+				WeakThis->OnQuestTock(WeakOwningCharacter.Get(), QuestAssetId);
+			}
+		});
+
+		GetRandomQuest(OwningCharacter, QuestDataloaded, EQuestShareType::Survival);
+	}
+}
+
+void AIQuestManager::QueueSurvivalQuestCheck(AIBaseCharacter* Character)
+{
+	if (Character && HasAuthority())
+	{
+		PendingSurvivalQuestChecks.AddUnique(Character);
+	}
 }
 
 void AIQuestManager::OnQuestTock(AIBaseCharacter* OwningCharacter, FPrimaryAssetId QuestAssetId)
@@ -1021,7 +1178,8 @@ void AIQuestManager::OnGetRandomQuest(AIBaseCharacter* Character, EQuestShareTyp
 					QuestSoftPtr.LoadSynchronous();
 					if (UClass* QuestBaseTaskClass = QuestSoftPtr.Get())
 					{
-						UIQuestExploreTask* ExploreTaskClass = NewObject<UIQuestExploreTask>(Character, QuestBaseTaskClass);
+						// Only class defaults are read here, so query the CDO rather than spawning a throwaway task
+						const UIQuestExploreTask* ExploreTaskClass = Cast<UIQuestExploreTask>(QuestBaseTaskClass->GetDefaultObject());
 						if (ExploreTaskClass)
 						{
 							if (ExploreTaskClass->bSkipIfAlreadyInside)
@@ -1111,7 +1269,7 @@ void AIQuestManager::OnGetRandomQuest(AIBaseCharacter* Character, EQuestShareTyp
 						continue;
 					}
 
-					UIQuestPersonalStat* StatTaskClass = NewObject<UIQuestPersonalStat>(Character, QuestBaseTaskClass);
+					UIQuestPersonalStat* StatTaskClass = Cast<UIQuestPersonalStat>(QuestBaseTaskClass->GetDefaultObject());
 					if (StatTaskClass)
 					{
 						bool bMeetsRequirements = StatTaskClass->MeetsStartRequirements(Character);
@@ -1150,7 +1308,7 @@ void AIQuestManager::OnGetRandomQuest(AIBaseCharacter* Character, EQuestShareTyp
 				QuestSoftPtr.LoadSynchronous();
 				if (UClass* QuestBaseTaskClass = QuestSoftPtr.Get())
 				{
-					UIQuestKillTask* KillTaskClass = NewObject<UIQuestKillTask>(Character, QuestBaseTaskClass);
+					const UIQuestKillTask* KillTaskClass = Cast<UIQuestKillTask>(QuestBaseTaskClass->GetDefaultObject());
 					if (!KillTaskClass) continue;
 
 					if (const UIQuestFishTask* const FishTaskClass = Cast<UIQuestFishTask>(KillTaskClass))
@@ -1273,38 +1431,15 @@ void AIQuestManager::GetRandomGroupQuest(AIPlayerGroupActor* PlayerGroupActor, F
 		}
 	}
 
-	// Collect possible tags from each player
-	TArray<FName, TInlineAllocator<3>> QuestTags;
+	// Only tags that every player has are considered
+	FGroupQuestTags GroupTags;
 	for (AIPlayerState* IPS : PlayerGroupActor->GetGroupMembers())
 	{
-		if (AIBaseCharacter* IBC = IPS->GetPawn<AIBaseCharacter>())
-		{
-			for (FName QuestTag : IBC->QuestTags)
-			{
-				if (!QuestTags.Contains(QuestTag))
-				{
-					QuestTags.Add(QuestTag);
-				}
-			}
-		}
+		GroupTags.AddMember(IPS->GetPawn<AIBaseCharacter>());
 	}
 
-	// Ensure every player has this tag, otherwise remove it
-	for (int32 i = QuestTags.Num(); i-- > 0;)
-	{
-		FName QuestTag = QuestTags[i];
-		for (AIPlayerState* IPS : PlayerGroupActor->GetGroupMembers())
-		{
-			if (AIBaseCharacter* IBC = IPS->GetPawn<AIBaseCharacter>())
-			{
-				if (!IBC->QuestTags.Contains(QuestTag))
-				{
-					QuestTags.RemoveAt(i);
-					break;
-				}
-			}
-		}
-	}
+	TArray<FName, TInlineAllocator<3>> QuestTags;
+	GroupTags.GetSharedQuestTags(QuestTags);
 
 	// determine if the group should be assigned a FeedGroupMemberQuest
 	bool bGetFeedQuest = false;
@@ -1519,7 +1654,7 @@ void AIQuestManager::OnGetRandomGroupQuest(EQuestFilter QuestFilter, TArray<FPri
 									QuestSoftPtr.LoadSynchronous();
 									if (UClass* QuestBaseTaskClass = QuestSoftPtr.Get())
 									{
-										if (UIQuestItemTask* ItemTaskClass = NewObject<UIQuestItemTask>(RemoteCharacter, QuestBaseTaskClass))
+										if (const UIQuestItemTask* ItemTaskClass = Cast<UIQuestItemTask>(QuestBaseTaskClass->GetDefaultObject()))
 										{
 											if (ItemTaskClass->Tag != RemoteCharacter->LastLocationTag || HasCompletedLocation(ItemTaskClass->Tag, RemoteCharacter)) continue;
 
@@ -1564,6 +1699,7 @@ void AIQuestManager::GetLocalWorldQuests(AIBaseCharacter* Character, FQuestsData
 
 	if (Quests.IsEmpty()) return;
 	if (!Character->LastLocationEntered || Character->LastLocationTag == NAME_None) return;
+	if (!HasLocalWorldQuestsForLocation(Character->LastLocationTag)) return;
 
 	ShuffleQuestArray(Quests);
 	TArray<FQuestCooldown> LocalCooldownWorldQuests = GetLocalWorldQuestsOnCooldown();
@@ -1685,7 +1821,7 @@ void AIQuestManager::FilterOnLocalWorldQuestsLoaded(TArray<UQuestData*> QuestsDa
 				{
 					if (QuestBaseTaskClass->IsChildOf(UIQuestWaterRestoreTask::StaticClass()))
 					{
-						if (UIQuestWaterRestoreTask* WaterTaskClass = NewObject<UIQuestWaterRestoreTask>(Character, QuestBaseTaskClass))
+						if (const UIQuestWaterRestoreTask* WaterTaskClass = Cast<UIQuestWaterRestoreTask>(QuestBaseTaskClass->GetDefaultObject()))
 						{
 							if (!ActiveWaterRestorationQuestTags.Contains(WaterTaskClass->Tag))
 							{
@@ -1706,7 +1842,7 @@ void AIQuestManager::FilterOnLocalWorldQuestsLoaded(TArray<UQuestData*> QuestsDa
 				{
 					if (QuestBaseTaskClass->IsChildOf(UIQuestWaystoneCooldownTask::StaticClass()))
 					{
-						if (UIQuestWaystoneCooldownTask* WaystoneTaskClass = NewObject<UIQuestWaystoneCooldownTask>(Character, QuestBaseTaskClass))
+						if (const UIQuestWaystoneCooldownTask* WaystoneTaskClass = Cast<UIQuestWaystoneCooldownTask>(QuestBaseTaskClass->GetDefaultObject()))
 						{
 							if (!ActiveWaystoneRestoreQuestTags.Contains(WaystoneTaskClass->Tag))
 							{
@@ -2362,7 +2498,7 @@ void AIQuestManager::AssignWaterReplenishQuest(AIBaseCharacter* TargetCharacter,
 										QuestSoftPtr.LoadSynchronous();
 										if (UClass* QuestBaseTaskClass = QuestSoftPtr.Get())
 										{
-											if (UIQuestItemTask* ItemTaskClass = NewObject<UIQuestItemTask>(TargetCharacter, QuestBaseTaskClass))
+											if (const UIQuestItemTask* ItemTaskClass = Cast<UIQuestItemTask>(QuestBaseTaskClass->GetDefaultObject()))
 											{
 												if (ItemTaskClass->Tag == TargetCharacter->LastLocationTag)
 												{
@@ -2834,6 +2970,12 @@ void AIQuestManager::AssignGroupMeetQuest(AIPlayerGroupActor* PlayerGroupActor)
 
 	if (InstanceLogoutSaveableInfo) GroupLeaderLocation = InstanceLogoutSaveableInfo->CaveReturnLocation;
 
+	FGroupQuestTags GroupTags;
+	for (const AIBaseCharacter* GroupMemberCharacter : GroupMembersCharacters)
+	{
+		GroupTags.AddMember(GroupMemberCharacter);
+	}
+
 	for (const FPrimaryAssetId& GroupMeetQuest : GroupMeetQuests)
 	{
 		// Load Quest Data for more complicated quest type picking
@@ -2842,8 +2984,7 @@ void AIQuestManager::AssignGroupMeetQuest(AIPlayerGroupActor* PlayerGroupActor)
 		check(QuestData);
 
 		// If the dinos on the group don't have the necessary tags, don't even try to assign this quest to them
-		TArrayView<const AIBaseCharacter*> GroupCharactersView = MakeArrayView(const_cast<const AIBaseCharacter**>(GroupMembersCharacters.GetData()), GroupMembersCharacters.Num());
-		if (!DoGroupMembersContainQuestTag(GroupCharactersView, QuestData->QuestTag))
+		if (!DoGroupMembersContainQuestTag(GroupTags, QuestData->QuestTag))
 		{
 			continue;
 		}
@@ -2853,7 +2994,7 @@ void AIQuestManager::AssignGroupMeetQuest(AIPlayerGroupActor* PlayerGroupActor)
 			QuestSoftPtr.LoadSynchronous();
 			if (UClass* QuestBaseTaskClass = QuestSoftPtr.Get())
 			{
-				UIQuestExploreTask* ExploreTaskClass = NewObject<UIQuestExploreTask>(PlayerGroupActor, QuestBaseTaskClass);
+				const UIQuestExploreTask* ExploreTaskClass = Cast<UIQuestExploreTask>(QuestBaseTaskClass->GetDefaultObject());
 				if (ExploreTaskClass)
 				{
 					for (AActor* POI : AllPointsOfInterest)
@@ -2893,16 +3034,9 @@ void AIQuestManager::AssignGroupMeetQuest(AIPlayerGroupActor* PlayerGroupActor)
 	AssignQuest(SelectedGroupMeetQuest, nullptr, false, PlayerGroupActor, true);
 }
 
-bool AIQuestManager::DoGroupMembersContainQuestTag(TArrayView<const AIBaseCharacter*> GroupMemberCharacters, const FName& QuestTag) const
+bool AIQuestManager::DoGroupMembersContainQuestTag(const FGroupQuestTags& GroupTags, const FName& QuestTag) const
 {
-	for (const AIBaseCharacter* const Character : GroupMemberCharacters)
-	{
-		if (QuestTag != NAME_QuestTagNone && !Character->QuestTags.Contains(QuestTag))
-		{
-			return false;
-		}
-	}
-	return true;
+	return QuestTag == NAME_QuestTagNone || GroupTags.AllMembersHaveQuestTag(QuestTag);
 }
 
 void AIQuestManager::UpdateGroupQuestsOnCooldown(FAlderonUID CharacterID, FPrimaryAssetId QuestId)
@@ -3387,7 +3521,7 @@ UIQuest* AIQuestManager::LoadQuest(AIBaseCharacter* Character, const FQuestSave&
 			{
 				if (IsActiveQuest && SavedQuest->QuestData->QuestType == EQuestType::Exploration)
 				{
-					if (UIQuestExploreTask* ExploreTaskClass = NewObject<UIQuestExploreTask>(Character, QuestBaseTaskClass))
+					if (const UIQuestExploreTask* ExploreTaskClass = Cast<UIQuestExploreTask>(QuestTask))
 					{
 						if (ExploreTaskClass->bSkipIfAlreadyInside)
 						{
@@ -3653,6 +3787,7 @@ void AIQuestManager::ResetQuest(AIBaseCharacter* TargetCharacter, UIQuest* Quest
 		if (TargetCharacter->GetActiveQuests().Contains(QuestToReset))
 		{
 			TargetCharacter->GetActiveQuests_Mutable().Remove(QuestToReset);
+			QuestToReset->OnRemovedFromActiveQuests();
 		}
 
 		// Destroy Quest
@@ -3707,6 +3842,7 @@ void AIQuestManager::RemoveQuest(AIBaseCharacter* TargetCharacter, UIQuest* Targ
 	if (TargetCharacter->GetActiveQuests().Contains(TargetQuest))
 	{
 		TargetCharacter->GetActiveQuests_Mutable().Remove(TargetQuest);
+		TargetQuest->OnRemovedFromActiveQuests();
 	}
 
 	// Let player controller know the quest failed
@@ -3798,6 +3934,7 @@ void AIQuestManager::OnQuestFail(AIBaseCharacter* TargetCharacter, UIQuest* Targ
 		if (TargetCharacter->GetActiveQuests().Contains(TargetQuest))
 		{
 			TargetCharacter->GetActiveQuests_Mutable().Remove(TargetQuest);
+			TargetQuest->OnRemovedFromActiveQuests();
 		}
 		
 		if (TargetCharacter->GetUncollectedRewardQuests().Contains(TargetQuest))
@@ -3872,6 +4009,7 @@ void AIQuestManager::OnQuestFail(AIBaseCharacter* TargetCharacter, UIQuest* Targ
 	if (TargetCharacter->GetActiveQuests().Contains(TargetQuest))
 	{
 		TargetCharacter->GetActiveQuests_Mutable().Remove(TargetQuest);
+		TargetQuest->OnRemovedFromActiveQuests();
 	}
 
 	// Remove Quest from Uncollected Reward Quests
@@ -4152,6 +4290,7 @@ void AIQuestManager::OnQuestCompleted(AIBaseCharacter* TargetCharacter, UIQuest*
 		if (TargetCharacter->GetActiveQuests().Contains(TargetQuest))
 		{
 			TargetCharacter->GetActiveQuests_Mutable().Remove(TargetQuest);
+			TargetQuest->OnRemovedFromActiveQuests();
 		}
 
 		TargetQuest->ConditionalBeginDestroy();
@@ -4322,6 +4461,7 @@ void AIQuestManager::OnQuestCompleted(AIBaseCharacter* TargetCharacter, UIQuest*
 	if (TargetCharacter->GetActiveQuests().Contains(TargetQuest))
 	{
 		TargetCharacter->GetActiveQuests_Mutable().Remove(TargetQuest);
+		TargetQuest->OnRemovedFromActiveQuests();
 	}
 
 	if (TargetQuest->QuestData->QuestShareType == EQuestShareType::Group)
@@ -4721,60 +4861,51 @@ void AIQuestManager::OnLocationDiscovered(FName LocationTag, const FText& Locati
 	AIPlayerState* IPlayerState = IPlayerController->GetPlayerState<AIPlayerState>();
 	if (!IPlayerState) return;
 
-	TArray<UIQuest*> QuestsToCheck = Character->GetActiveQuests();
+	TArray<UIQuest*, TInlineAllocator<4>> QuestsToCheck;
+	Character->GetActiveQuestsForLocation(LocationTag, QuestsToCheck);
 
 	// Get Local World Quests assigned to the player
 	for (UIQuest* ActiveQuest : QuestsToCheck)
 	{
-		if (!ActiveQuest || !ActiveQuest->QuestData || ActiveQuest->QuestData->QuestShareType != EQuestShareType::LocalWorld || ActiveQuest->QuestData->LocationTag != LocationTag) continue;
+		if (!ActiveQuest->QuestData || ActiveQuest->QuestData->QuestShareType != EQuestShareType::LocalWorld || ActiveQuest->QuestData->LocationTag != LocationTag) continue;
 
-		if (bEntered)
-		{
-			UpdateLocalQuestFailure(ActiveQuest, Character, true);
-		}
-		else
-		{
-			UpdateLocalQuestFailure(ActiveQuest, Character, false);
-		}
+		UpdateLocalQuestFailure(ActiveQuest, Character, bEntered);
 	}
 
 	// Try to progress Exploration Quest Tasks
 	for (UIQuest* ActiveQuest : QuestsToCheck)
 	{
-		if (ActiveQuest)
-		{
-			bool bProgressGained = false;
-
-			UQuestData* QuestData = ActiveQuest->QuestData;
-			if (!QuestData && QuestData->QuestShareType != EQuestShareType::Personal) continue;
+		// Quests can be completed or removed by the failure updates above
+		if (!IsValid(ActiveQuest) || !ActiveQuest->QuestData) continue;
 
-			TArray<UIQuestBaseTask*> QuestTasks;
+		UIQuestExploreTask* ProgressedTask = nullptr;
 
-			if (QuestData->bInOrderQuestTasks) {
-				QuestTasks.Add(ActiveQuest->GetActiveTask());
-			} else {
-				QuestTasks = ActiveQuest->GetQuestTasks();
+		if (ActiveQuest->QuestData->bInOrderQuestTasks)
+		{
+			UIQuestExploreTask* ExploreTask = Cast<UIQuestExploreTask>(ActiveQuest->GetActiveTask());
+			if (ExploreTask && ExploreTask->Tag == LocationTag)
+			{
+				ProgressedTask = ExploreTask;
 			}
-
-			for (UIQuestBaseTask* QuestTask : QuestTasks)
+		}
+		else
+		{
+			for (UIQuestBaseTask* QuestTask : ActiveQuest->GetQuestTasks())
 			{
-				// Process Only Kill Tasks
 				UIQuestExploreTask* ExploreTask = Cast<UIQuestExploreTask>(QuestTask);
-				if (!ExploreTask) continue;
-
-				if (ExploreTask->Tag == LocationTag)
+				if (ExploreTask && ExploreTask->Tag == LocationTag)
 				{
-					ExploreTask->SetIsCompleted(true);
-					bProgressGained = true;
+					ProgressedTask = ExploreTask;
 					break;
 				}
 			}
+		}
 
-			if (bProgressGained)
-			{
-				OnQuestUpdated(Character, ActiveQuest, bProgressGained);
-				break;
-			}
+		if (ProgressedTask)
+		{
+			ProgressedTask->SetIsCompleted(true);
+			OnQuestUpdated(Character, ActiveQuest, true);
+			break;
 		}
 	}
 
@@ -5938,6 +6069,7 @@ void AIQuestManager::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLi
 	DOREPLIFETIME_WITH_PARAMS_FAST(AIQuestManager, MaxUnclaimedRewards, Params);
 	DOREPLIFETIME_WITH_PARAMS_FAST(AIQuestManager, bEnableMaxUnclaimedRewards, Params);
 	DOREPLIFETIME_WITH_PARAMS_FAST(AIQuestManager, bTrophyQuests, Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(AIQuestManager, bResolvingPOIZones, Params);
 }
 
 // Hook for when player does generic thing like opening a menu
@@ -6075,6 +6207,20 @@ void AIQuestManager::OnServerLoadAllQuests(TArray<UQuestData*> QuestsData, TMap<
 
 FORCEINLINE void AIQuestManager::ServerAddQuest(UQuestData* QuestData, const FPrimaryAssetId& QuestAssetId)
 {
+	ServerLoadedQuests.Emplace(QuestData);
+
+	// Load the task classes first, the per type registration below reads them
+	for (TSoftClassPtr<UIQuestBaseTask>& QuestSoftPtr : QuestData->QuestTasks)
+	{
+		QuestSoftPtr.LoadSynchronous();
+
+		TSubclassOf<UIQuestBaseTask> QuestBaseTaskClass = QuestSoftPtr.Get();
+		if (QuestBaseTaskClass)
+		{
+			ServerLoadedQuestTasks.Emplace(QuestBaseTaskClass);
+		}
+	}
+
 	switch (QuestData->QuestShareType)
 	{
 		case EQuestShareType::Survival:
@@ -6098,19 +6244,6 @@ FORCEINLINE void AIQuestManager::ServerAddQuest(UQuestData* QuestData, const FPr
 			break;
 		}
 	}
-
-	ServerLoadedQuests.Emplace(QuestData);
-
-	for (TSoftClassPtr<UIQuestBaseTask>& QuestSoftPtr : QuestData->QuestTasks)
-	{
-		QuestSoftPtr.LoadSynchronous();
-
-		TSubclassOf<UIQuestBaseTask> QuestBaseTaskClass = QuestSoftPtr.Get();
-		if (QuestBaseTaskClass)
-		{
-			ServerLoadedQuestTasks.Emplace(QuestBaseTaskClass);
-		}
-	}
 }
 
 FORCEINLINE void AIQuestManager::ServerAddLocalWorldQuest(UQuestData* QuestData, const FPrimaryAssetId& QuestAssetId)
@@ -6133,6 +6266,32 @@ FORCEINLINE void AIQuestManager::ServerAddLocalWorldQuest(UQuestData* QuestData,
 			break;
 		}
 	}
+
+	// Quests without tasks skip the location check in FilterOnLocalWorldQuestsLoaded and can be handed out anywhere
+	if (QuestData->QuestTasks.IsEmpty())
+	{
+		bHasUnlocatedLocalWorldQuests = true;
+		return;
+	}
+
+	LocalWorldQuestLocationTags.Add(QuestData->LocationTag);
+
+	// Task classes were already loaded by ServerAddQuest
+	for (const TSoftClassPtr<UIQuestBaseTask>& QuestSoftPtr : QuestData->QuestTasks)
+	{
+		UClass* QuestBaseTaskClass = QuestSoftPtr.Get();
+		if (!QuestBaseTaskClass) continue;
+
+		if (const UIQuestItemTask* ItemTaskClass = Cast<UIQuestItemTask>(QuestBaseTaskClass->GetDefaultObject()))
+		{
+			LocalWorldQuestLocationTags.Add(ItemTaskClass->Tag);
+		}
+	}
+}
+
+bool AIQuestManager::HasLocalWorldQuestsForLocation(FName LocationTag) const
+{
+	return bHasUnlocatedLocalWorldQuests || LocalWorldQuestLocationTags.Contains(LocationTag);
 }
 
 FORCEINLINE void AIQuestManager::ServerAddGroupQuest(UQuestData* QuestData, const FPrimaryAssetId& QuestAssetId)
@@ -42,6 +42,17 @@ enum class EPOTAdjustMethod
 	AM_Max
 };
 
+// Context that a PostGameplayEffectExecute handler reads, anything not listed is never resolved for that attribute
+enum class EPOTExecuteContext : uint8
+{
+	None = 0,
+	HitResult = 1 << 0,
+	Instigator = 1 << 1,
+	TargetState = 1 << 2,
+	All = HitResult | Instigator | TargetState
+};
+ENUM_CLASS_FLAGS(EPOTExecuteContext);
+
 USTRUCT()
 struct FPOTAdjustCurrentAttribute
 {
@@ -116,6 +127,14 @@ struct FPOTAdjustCurrentAttribute
 	FGameplayAttributeData* MaxAttribute = nullptr;
 	const FName* DebuffName = nullptr;
 	EPOTAdjustMethod AdjustMethod;
+
+	// Key into the attribute caps config, built once with the table so clamping doesn't allocate a new FName per change
+	FName CapName = NAME_None;
+
+	// Resolved from DebuffName on first use, the tag manager isn't guaranteed to be ready when the table is built.
+	// A name that fails to resolve is remembered so it isn't looked up again on every change.
+	FGameplayTag DebuffTag;
+	bool bDebuffTagResolved = false;
 };
 
 USTRUCT()
@@ -631,6 +650,12 @@ public:
 	TMap<const FGameplayAttribute, FPOTIncomingStatusHandling> CallForIncomingStatusHandling;
 	TMap<const FGameplayAttribute, FPOTStatusHandling> CallForStatusHandling;
 
+	// Attributes PostGameplayEffectExecute has a handler for, and the context each handler needs
+	TMap<const FGameplayAttribute, EPOTExecuteContext> PostExecuteHandlers;
+
+	/** Tags from DebuffTagsToRemove, resolved once */
+	static const FGameplayTagContainer& GetDebuffTagsToRemove();
+
 	static bool CanBeDamaged(const AIBaseCharacter* TargetCharacter);
 	
 	void HandleIncomingStatusAttributeChange(
@@ -644,11 +669,17 @@ public:
 
 	UFUNCTION(BlueprintCallable)
 	static float FindAttributeCapFromConfig(const FGameplayAttribute& Attribute);
+	static float FindAttributeCapFromConfigByName(const FName& AttributeName);
 
 	/** Helper function to proportionally adjust the value of an attribute when it's associated max attribute changes. (i.e. When MaxHealth increases, Health increases by an amount that maintains the same percentage as before) */
 	void AdjustAttributeForMaxChange(const FGameplayAttribute& MaxAttributeProperty, const float NewMaxValue, const FGameplayAttribute& AffectedAttributeProperty);
 
+	/** Updates the tag named TagName for external callers. PreAttributeChange calls UpdateTagBasedOnAttributeTag directly and does not route through this. */
 	virtual void UpdateTagBasedOnAttribute(const FGameplayAttribute& Attribute, const float NewValue, const FName& TagName);
+	void UpdateTagBasedOnAttributeTag(const FGameplayAttribute& Attribute, const float NewValue, const FGameplayTag& Tag);
+
+	/** Debuff tag of an AdjustForCurrentAttributes entry, resolved once. Invalid if DebuffName isn't a registered tag. */
+	static const FGameplayTag& ResolveDebuffTag(FPOTAdjustCurrentAttribute& CurrentAdjust);
 
 	virtual void PreAttributeChange(const FGameplayAttribute& Attribute, float& NewValue) override;
 	static void GetNewAttributeVsCapValue(const FPOTAdjustCurrentAttribute& CurrentAdjust, const FGameplayAttribute& Attribute, float& NewValue);
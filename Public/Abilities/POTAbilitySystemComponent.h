@@ -6,6 +6,7 @@
 #include "GameplayTagContainer.h"
 #include "POTAbilityTypes.h"
 #include "POTAbilitySystemComponentBase.h"
+#include "Net/Serialization/FastArraySerializer.h"
 #include "POTAbilitySystemComponent.generated.h"
 
 /************************************************************************/
@@ -13,31 +14,46 @@
 /************************************************************************/
 
 class UPOTGameplayAbility;
+class UPOTAbilitySystemComponent;
+struct FPOTAbilityMontageArray;
 
+/**
+ * An ability montage playing on the server. Position and play rate are only sent when the montage starts or is resynced
+ * (seek, section or play rate change), clients let the montage play on from there.
+ */
 USTRUCT()
-struct FPOTGameplayAbilityRepAnimMontage
+struct FPOTAbilityMontageItem : public FFastArraySerializerItem
 {
-	GENERATED_USTRUCT_BODY()
+	GENERATED_BODY()
 
-	FPOTGameplayAbilityRepAnimMontage() {}
+public:
+	UPROPERTY()
+	UAnimMontage* AnimMontage = nullptr;
 
-	// Create a new FPOTGameplayAbilityRepAnimMontage with a new Unique Id
-	static FPOTGameplayAbilityRepAnimMontage Generate();
+	UPROPERTY()
+	float PlayRate = 1.f;
 
-	// Need a unique ID to ensure montages are replicated properly. Montages aren't getting replicated correctly when 
-	// a new one is added at the same time as an old one is removed, because the values can be exactly the same (despite needing to be reset)
 	UPROPERTY()
-	uint32 UniqueId = 0;
+	float Position = 0.f;
 
+	// Server world time Position was sampled at, lets clients that receive the item late catch up
 	UPROPERTY()
-	FGameplayAbilityRepAnimMontage InnerMontage;
+	float PositionTime = 0.f;
 
-	bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess);
+	// Server only, section the montage was in when it was last sent
+	UPROPERTY(NotReplicated)
+	int32 SectionIndex = INDEX_NONE;
+
+	void PreReplicatedRemove(const FPOTAbilityMontageArray& InArraySerializer);
+	void PostReplicatedAdd(const FPOTAbilityMontageArray& InArraySerializer);
+	void PostReplicatedChange(const FPOTAbilityMontageArray& InArraySerializer);
 
+	// Play rate and position are quantized, the montage plays on locally between updates anyway
+	bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess);
 };
 
 template<>
-struct TStructOpsTypeTraits<FPOTGameplayAbilityRepAnimMontage> : public TStructOpsTypeTraitsBase2<FPOTGameplayAbilityRepAnimMontage>
+struct TStructOpsTypeTraits<FPOTAbilityMontageItem> : public TStructOpsTypeTraitsBase2<FPOTAbilityMontageItem>
 {
 	enum
 	{
@@ -45,6 +61,46 @@ struct TStructOpsTypeTraits<FPOTGameplayAbilityRepAnimMontage> : public TStructO
 	};
 };
 
+USTRUCT()
+struct FPOTAbilityMontageArray : public FFastArraySerializer
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY()
+	TArray<FPOTAbilityMontageItem> Items;
+
+	UPROPERTY(NotReplicated)
+	UPOTAbilitySystemComponent* Owner = nullptr;
+
+	FORCEINLINE int32 Num() const { return Items.Num(); }
+
+	FPOTAbilityMontageItem* FindByMontage(const UAnimMontage* Montage)
+	{
+		return Items.FindByPredicate([Montage](const FPOTAbilityMontageItem& Item) { return Item.AnimMontage == Montage; });
+	}
+
+	void RemoveItemAt(const int32 Index)
+	{
+		Items.RemoveAt(Index);
+		MarkArrayDirty();
+	}
+
+	bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+	{
+		return FFastArraySerializer::FastArrayDeltaSerialize<FPOTAbilityMontageItem, FPOTAbilityMontageArray>(Items, DeltaParms, *this);
+	}
+};
+
+template<>
+struct TStructOpsTypeTraits<FPOTAbilityMontageArray> : public TStructOpsTypeTraitsBase2<FPOTAbilityMontageArray>
+{
+	enum
+	{
+		WithNetDeltaSerializer = true,
+	};
+};
+
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnAttackAbilitySignature, UPOTGameplayAbility*, AttackAbility, const bool, bCancelled);
 
 // Damn UE4 and this workarounds ..
@@ -329,6 +385,66 @@ public:
 	}
 };
 
+/**
+ * Movement overrides of the current attack and non exclusive abilities, rebuilt whenever that set changes so
+ * the movement component can read flags instead of walking the abilities every substep.
+ */
+struct FPOTMovementOverrideSnapshot
+{
+	bool bForcedMovementSpeed = false;
+	bool bVerticalControlInWater = false;
+	bool bOverrideImmersionDepth = false;
+
+	// Abilities with bApplyMovementOverride, their speed is a blueprint event so it is still asked for
+	TArray<TWeakObjectPtr<UPOTGameplayAbility>, TInlineAllocator<2>> SpeedOverrideAbilities;
+
+	// Abilities that implement HasForcedMovementRotation, in priority order (attack ability first)
+	TArray<TWeakObjectPtr<UPOTGameplayAbility>, TInlineAllocator<2>> RotationAbilities;
+
+	// Bumped on every rebuild
+	uint32 Version = 0;
+};
+
+enum class EPOTAttributeThresholdDirection : uint8
+{
+	// Passed while the ratio is at or above the threshold
+	Rising,
+	// Passed while the ratio is at or below the threshold
+	Falling
+};
+
+DECLARE_DELEGATE(FPOTAttributeThresholdCrossed);
+
+/**
+ * Watch on the ratio of two attributes (eg Hunger / MaxHunger), only evaluated from the change delegates of those attributes.
+ * Once passed, the ratio has to move back past the threshold by Hysteresis before the watch can fire again.
+ */
+struct FPOTAttributeThresholdWatch
+{
+	int32 Handle = INDEX_NONE;
+
+	// The watch is dropped once its owner is gone
+	TWeakObjectPtr<const UObject> Owner;
+
+	FGameplayAttribute ValueAttribute;
+	FGameplayAttribute MaxAttribute;
+
+	float Threshold = 0.f;
+	float Hysteresis = 0.f;
+	EPOTAttributeThresholdDirection Direction = EPOTAttributeThresholdDirection::Rising;
+
+	// When set the watch never passes without a positive max value
+	bool bRequirePositiveMax = false;
+
+	// Latched state used to fire OnCrossed, only released once the ratio moves back past the threshold by Hysteresis
+	bool bPassed = false;
+
+	// Whether the ratio is past the exact threshold right now, ignoring Hysteresis
+	bool bAtThreshold = false;
+
+	FPOTAttributeThresholdCrossed OnCrossed;
+};
+
 
 /**
  * 
@@ -474,17 +590,23 @@ public:
 	void Server_HitWallEvent(const FHitResult& HitResult);
 	void Server_HitWallEvent_Implementation(const FHitResult& HitResult);
 
-	FORCEINLINE const TArray<FPOTGameplayAbilityRepAnimMontage>& GetAbilityMontages() const { return AbilityMontages; }
+	FORCEINLINE const TArray<FPOTAbilityMontageItem>& GetAbilityMontages() const { return AbilityMontages.Items; }
+
+	FPOTAbilityMontageArray& GetAbilityMontages_Mutable();
 
-	TArray<FPOTGameplayAbilityRepAnimMontage>& GetAbilityMontages_Mutable();
+	void OnReplicatedAbilityMontageChanged(const FPOTAbilityMontageItem& Item);
+	void OnReplicatedAbilityMontageRemoved(const FPOTAbilityMontageItem& Item);
 
 protected:
 	
-	UPROPERTY(ReplicatedUsing = OnRep_AbilityMontages)
-	TArray<FPOTGameplayAbilityRepAnimMontage> AbilityMontages;
+	UPROPERTY(Replicated)
+	FPOTAbilityMontageArray AbilityMontages;
 
-	UFUNCTION()
-	void OnRep_AbilityMontages();
+	// Server only, time since AbilityMontages was last resampled
+	float AbilityMontageSampleTime = 0.f;
+
+	// Samples the montage from the anim instance into the item, returns true if anything a client needs changed
+	bool SampleAbilityMontage(const UAnimInstance& AnimInstance, FPOTAbilityMontageItem& Item, bool bForceResync) const;
 
 public:
 	
@@ -616,6 +738,22 @@ public:
 	bool HasAbilityForcedRotation() const;
 	FRotator GetAbilityForcedRotation() const;
 
+	FORCEINLINE uint32 GetMovementOverrideVersion() const
+	{
+		return MovementOverrides.Version;
+	}
+
+	// Registers a threshold watch and evaluates it right away. OnCrossed only fires for later crossings, check bAtThreshold for the initial state.
+	int32 AddAttributeThresholdWatch(const UObject* Owner, const FGameplayAttribute& ValueAttribute, const FGameplayAttribute& MaxAttribute, float Threshold,
+		EPOTAttributeThresholdDirection Direction, FPOTAttributeThresholdCrossed OnCrossed, bool bRequirePositiveMax = false, float Hysteresis = 0.02f);
+	void RemoveAttributeThresholdWatch(int32 Handle);
+
+	const FPOTAttributeThresholdWatch* FindAttributeThresholdWatch(int32 Handle) const;
+	const FPOTAttributeThresholdWatch* FindAttributeThresholdWatchByOwner(const UObject* Owner) const;
+
+	// 0 unless both value and max are positive
+	static float GetAttributeThresholdRatio(float Value, float MaxValue);
+
 	UFUNCTION(BlueprintCallable, Category = "Wa Combat")
 	void FinishAbilityWithMontage(UAnimMontage* Montage);
 
@@ -662,6 +800,7 @@ protected:
 	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 	virtual void InitializeComponent() override;
+	virtual void PostInitProperties() override;
 
 	virtual void AddGameplayTagToOwner(const FGameplayTag& InTag, const bool bFast = false);
 	virtual void RemoveGameplayTagFromOwner(const FGameplayTag& InTag);
@@ -675,6 +814,9 @@ protected:
 	UPROPERTY()
 	TArray<UPOTGameplayAbility*> NonExclusiveAbilities;
 
+	void RebuildMovementOverrides();
+	FPOTMovementOverrideSnapshot MovementOverrides;
+
 	bool GetActiveEffectsNextPeriodAndDuration(const FGameplayEffectQuery& Query, float& NextPeriod, float& Duration) const;
 
 	void OnGrowthChanged(const FOnAttributeChangeData& ChangeData);
@@ -708,5 +850,14 @@ private:
 
 	FTimerHandle LocomotionUpdateTimerHandle;
 
+	void OnThresholdAttributeChanged(const FOnAttributeChangeData& ChangeData);
+
+	// Returns true when the watch went from not passed to passed
+	bool EvaluateAttributeThreshold(FPOTAttributeThresholdWatch& Watch) const;
+
+	TArray<FPOTAttributeThresholdWatch> AttributeThresholdWatches;
+	TSet<FGameplayAttribute> AttributeThresholdBoundAttributes;
+	int32 LastAttributeThresholdHandle = 0;
+
 	friend class UPOTGameplayAbility;
 };
@@ -15,11 +15,30 @@ struct FSavedGameplayEffectData
 	GENERATED_BODY()
 
 public:
+	// Version 0 only stored Effect and Duration, version 1 adds the spec state below
+	static constexpr uint8 CurrentVersion = 1;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, SaveGame)
-	const UGameplayEffect* Effect;
+	const UGameplayEffect* Effect = nullptr;
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, SaveGame)
-	float Duration;
+	float Duration = 0.f;
+
+	UPROPERTY(SaveGame, NotReplicated)
+	uint8 Version = 0;
+
+	UPROPERTY(SaveGame, NotReplicated)
+	float Level = 1.f;
+
+	UPROPERTY(SaveGame, NotReplicated)
+	int32 StackCount = 1;
+
+	// Time until the next periodic execution, 0 if the effect is not periodic
+	UPROPERTY(SaveGame, NotReplicated)
+	float PeriodRemaining = 0.f;
+
+	UPROPERTY(SaveGame, NotReplicated)
+	TMap<FGameplayTag, float> SetByCallerMagnitudes;
 
 public:
 	FSavedGameplayEffectData()
@@ -81,6 +100,10 @@ public:
 
 	bool bAttributesLoaded;
 
+	// Initter data version and group of the last full attribute init, growth ticks only write growth-varying attributes while these match
+	uint32 LoadedAttributeDefaultsVersion = 0;
+	FName LoadedAttributeGroupName;
+
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Character")
 	TArray<TSubclassOf<UGameplayEffect>> InitialGameplayEffects;
 
@@ -212,9 +235,23 @@ public:
 	UFUNCTION(BlueprintPure)
 	float GetTotalHealthBleed(const bool bRatio = false) const;
 
+	UFUNCTION(BlueprintPure)
+	float GetTotalHealthPoison(const bool bRatio = false) const;
+
+	UFUNCTION(BlueprintPure)
+	float GetTotalHealthVenom(const bool bRatio = false) const;
+
 	UFUNCTION(BlueprintPure)
 	float GetTotalStaminaDrain(const bool bRatio = false) const;
 
+	// Status ticks until a damage over time status (e.g. BleedingRate / BleedingHealRate) heals back to zero, INDEX_NONE if it never does
+	UFUNCTION(BlueprintPure)
+	int32 GetStatusTicksToClear(const FGameplayAttribute& RateAttribute, const FGameplayAttribute& HealRateAttribute) const;
+
+	// First status tick at which a damage over time status has dealt the current health, INDEX_NONE if it clears before that
+	UFUNCTION(BlueprintPure)
+	int32 GetStatusTicksToDeath(const FGameplayAttribute& RateAttribute, const FGameplayAttribute& HealRateAttribute) const;
+
 	/**
 	 * @param Delta raw number
 	 * @param DeltaPercentage - percentage of effect duration
@@ -230,6 +267,12 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Wa Combat", meta = (AdvancedDisplay = 2))
 	void ModifyActiveGameplayEffectDurationByHandle(FActiveGameplayEffectHandle Handle, float Delta, float DeltaPercentage = 0.f);
 
+	/** Captures every active effect with a finite remaining duration, including level, stacks, period phase and set by caller magnitudes. */
+	void SaveActiveGameplayEffects(TArray<FSavedGameplayEffectData>& OutSavedEffects) const;
+
+	/** Applies a saved effect once with its remaining duration already set, returns the new active handle. */
+	FActiveGameplayEffectHandle ApplySavedGameplayEffect(const FSavedGameplayEffectData& SavedEffect);
+
 	UFUNCTION(BlueprintCallable)
 	void SetGrowthForceInhibited(bool bInhibited)
 	{
@@ -334,12 +377,28 @@ protected:
 
 	void ClearDelayedCooldown(const UGameplayEffect* Cooldown);
 
+	// Total health a damage over time status will take before its heal rate brings it back to zero
+	float GetProjectedStatusDamage(const FGameplayAttribute& RateAttribute, const FGameplayAttribute& HealRateAttribute, const bool bRatio) const;
+
+	// Rebuilds CooldownTagExpiry, must be called whenever CurrentCooldownEffects or CurrentCooldownDelays change
+	void RebuildCooldownTagIndex();
+
+	// Granted cooldown tag -> latest world time any cooldown effect or delay granting it expires
+	TMap<FGameplayTag, float> CooldownTagExpiry;
+
 private:
 	bool bGrowthInhibited;
 	bool bGrowthForceInhibited;
 
 	FTimerHandle GrowthInhibitionTimerHandle;
 	FActiveGameplayEffectHandle GrowthInhibitionHandle;
+
+	// Result of the last clearance overlap, reused while the capsule has not moved or resized
+	FVector LastGrowthClearanceLocation = FVector::ZeroVector;
+	float LastGrowthClearanceRadius = 0.f;
+	float LastGrowthClearanceHalfHeight = 0.f;
+	float LastGrowthClearanceTime = -1.f;
+	bool bLastGrowthClearanceBlocked = false;
 private:
 	UPROPERTY(Transient)
 	TMap<TSubclassOf<UGameplayEffect>, FActiveGameplayEffectHandle> TrackedClientUIEffects;
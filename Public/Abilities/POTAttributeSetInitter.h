@@ -27,7 +27,19 @@ public:
 	virtual void InitAttributeSetDefaultsGradient(UAbilitySystemComponent* AbilitySystemComponent, FName GroupName, float Level, bool bInitialInit) const;
 	virtual void ApplyAttributeDefaultGradient(UAbilitySystemComponent* AbilitySystemComponent, FGameplayAttribute& InAttribute, FName GroupName, float Level) const;
 
-	
+	/**
+	 * Growth tick path. Only writes the attributes that vary between levels and whose interpolated value changed,
+	 * so unchanged attributes are neither clamped again nor marked dirty. Returns the number of attributes written.
+	 * Callers must have run InitAttributeSetDefaultsGradient with the current DefaultsVersion first.
+	 */
+	virtual int32 UpdateAttributeSetDefaultsGradient(UAbilitySystemComponent* AbilitySystemComponent, FName GroupName, float Level) const;
+
+	// Bumped every time attribute data is (re)loaded, growth-invariant attributes need a full init when it changes
+	uint32 GetDefaultsVersion() const
+	{
+		return DefaultsVersion;
+	}
+
 
 protected:
 	TSubclassOf<UAttributeSet> FindBestAttributeClass(TArray<TSubclassOf<UAttributeSet> >& ClassList, FString PartialName);
@@ -59,9 +71,28 @@ protected:
 			float		Value;
 		};
 
+		// Lists of different levels usually share their order, so the index is tried first
+		const FOffsetValuePair* FindPair(const FProperty* InProperty, int32 HintIndex) const
+		{
+			if (List.IsValidIndex(HintIndex) && List[HintIndex].Property == InProperty)
+			{
+				return &List[HintIndex];
+			}
+
+			return List.FindByPredicate([InProperty](const FOffsetValuePair& Pair) { return Pair.Property == InProperty; });
+		}
+
 		TArray<FOffsetValuePair>	List;
 	};
 
+	struct FPOTGrowthVaryingAttribute
+	{
+		FProperty* Property;
+
+		// Index in the first level's value list, used as a lookup hint for the others
+		int32 ListIndex;
+	};
+
 	struct FPOTAttributeSetDefaults
 	{
 		TMap<TSubclassOf<UAttributeSet>, FPOTAttributeDefaultValueList> DataMap;
@@ -70,6 +101,9 @@ protected:
 	struct FPOTAttributeSetDefaultsCollection
 	{
 		TArray<FPOTAttributeSetDefaults>		LevelData;
+
+		// Attributes whose value differs between at least two levels, filled at preload time
+		TMap<TSubclassOf<UAttributeSet>, TArray<FPOTGrowthVaryingAttribute>> GrowthVaryingAttributes;
 	};
 
 	TMap<FName, FPOTAttributeSetDefaultsCollection>	Defaults;
@@ -80,6 +114,15 @@ protected:
 
 	void PreloadCurveData(const TArray<UCurveTable*>& CurveData, TMap<FName, FPOTAttributeSetDefaultsCollection>& InDefaults);
 	void PreloadCurveDataFromCSV(const FString& CSV, TMap<FName, FPOTAttributeSetDefaultsCollection>& InDefaults);
+	void ClassifyGrowthVaryingAttributes(TMap<FName, FPOTAttributeSetDefaultsCollection>& InDefaults);
+
+	const FPOTAttributeSetDefaultsCollection* FindGradientCollection(FName GroupName, const FPOTAttributeSetDefaultsCollection*& OutModCollection) const;
+
+	// Interpolates a property between two levels, preferring the mod values when the mod data defines the property
+	static bool LerpAttributeDefault(const FProperty* Property, int32 HintIndex, const FPOTAttributeDefaultValueList& Bottom, const FPOTAttributeDefaultValueList& Top,
+		const FPOTAttributeDefaultValueList* ModBottom, const FPOTAttributeDefaultValueList* ModTop, float Alpha, float& OutValue);
+
+	uint32 DefaultsVersion = 0;
 
 private:
 	bool PreloadRow(const FString& RowName, const FString& ClassName, const FString& SetName, const FString& AttributeName, const FRealCurve* Curve, TMap<FName, FPOTAttributeSetDefaultsCollection>& InDefaults);
@@ -8,6 +8,41 @@
 #include "ICharacterMovementComponent.generated.h"
 
 class AIDinosaurCharacter;
+class AIBaseCharacter;
+class AIAdminCharacter;
+class UPOTAbilitySystemComponent;
+
+/**
+ * Owner lookups and growth multipliers the speed / acceleration queries need. These don't change within a move,
+ * so they are resolved once per performed or simulated move instead of on every query.
+ */
+struct FPOTMoveParameters
+{
+	const APawn* ResolvedFor = nullptr;
+
+	AIBaseCharacter* BaseOwner = nullptr;
+	AIDinosaurCharacter* DinoOwner = nullptr;
+	AIAdminCharacter* AdminOwner = nullptr;
+	UPOTAbilitySystemComponent* AbilitySystem = nullptr;
+
+	float SpeedGrowthMultiplier = 1.f;
+	float SwimSpeedGrowthMultiplier = 1.f;
+	float FlySpeedGrowthMultiplier = 1.f;
+	float AccelerationGrowthMultiplier = 1.f;
+
+	bool bValid = false;
+};
+
+// How much simulation a remote character gets on this client, see UICharacterMovementComponent::CalculateProxySignificance
+enum class EProxyMovementSignificance : uint8
+{
+	// Full simulation every frame
+	High,
+	// Full simulation at a reduced rate, extrapolated in between
+	Medium,
+	// As Medium at a lower rate, without additional capsules or ground floor checks
+	Low
+};
 
 struct FICharacterMoveResponseDataContainer : FCharacterMoveResponseDataContainer
 {
@@ -658,7 +693,33 @@ protected:
 	UPROPERTY(Transient)
 	TMap<const class UPrimitiveComponent*, FHitResult> CachedHits;
 
+	const FPOTMoveParameters& GetMoveParameters() const;
+
+	FORCEINLINE EProxyMovementSignificance GetProxySignificance() const
+	{
+		return ProxySignificance;
+	}
+
+	EProxyMovementSignificance CalculateProxySignificance() const;
+	void UpdateProxySignificance(float DeltaSeconds);
+
+	// Moves a reduced significance proxy along its velocity and floor without sweeping, then runs the usual post movement updates.
+	// Returns false when a full simulation step is due. Proxies on a moving base always take the full step.
+	bool TryExtrapolateProxy(float DeltaSeconds);
+
+	// Forces the next GetMoveParameters call to resolve again, called at the start of every move
+	FORCEINLINE void InvalidateMoveParameters()
+	{
+		MoveParameters.bValid = false;
+	}
+
 private:
+	mutable FPOTMoveParameters MoveParameters;
+
+	EProxyMovementSignificance ProxySignificance = EProxyMovementSignificance::High;
+	float ProxySignificanceCountdown = 0.f;
+	float ProxyTimeSinceSimulation = 0.f;
+
 	int32 IncrementalUpdateIndex;
 
 	bool bIsDescending = false;
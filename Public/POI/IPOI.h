@@ -50,6 +50,8 @@ public:
 		return Mesh;
 	}
 
+	bool IsServerResolvingZones() const;
+
 	// Exploration quests will only consider this POI if the Character has any of these Tags, or there are no tags.
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = POI)
 	TArray<FName> RequiredExplorationQuestTags;
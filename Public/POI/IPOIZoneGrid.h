@@ -0,0 +1,81 @@
+// Copyright 2019-2022 Alderon Games Pty Ltd, All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class AIPOI;
+class AIBaseCharacter;
+
+/**
+ * Convex piece of a POI volume, flattened to a 2D hull and extruded between MinZ and MaxZ.
+ */
+struct FPOIZoneShape
+{
+	// Counter-clockwise hull in world XY
+	TArray<FVector2D> Hull;
+
+	FBox2D Bounds = FBox2D(ForceInit);
+	float MinZ = 0.f;
+	float MaxZ = 0.f;
+
+	bool Contains(const FVector& Location) const;
+};
+
+struct FPOIZone
+{
+	TWeakObjectPtr<AIPOI> POI;
+	TArray<FPOIZoneShape> Shapes;
+	FBox2D Bounds = FBox2D(ForceInit);
+
+	bool Contains(const FVector& Location) const;
+};
+
+struct FPOIZoneMembership
+{
+	int32 ZoneIndex = INDEX_NONE;
+
+	// Last state that was reported to the POI
+	bool bInside = false;
+
+	// Consecutive passes that disagreed with bInside
+	uint8 PendingPasses = 0;
+};
+
+/**
+ * Server side replacement for POI mesh overlaps. Each POI is baked into convex prisms and bucketed
+ * into a 2D grid, character membership is then tested in a single batched pass and debounced before
+ * the POI enter / exit handlers are called.
+ */
+class PATHOFTITANS_API FPOIZoneGrid
+{
+public:
+	// True when dedicated servers resolve POI membership themselves and clients should not report overlaps
+	static bool IsServerAuthoritative();
+
+	// Seconds between membership passes
+	static float GetUpdateInterval();
+
+	void Build(const TArray<AIPOI*>& POIs);
+	void Reset();
+
+	void UpdateMembership(const TArray<AIBaseCharacter*>& Characters);
+
+	int32 NumZones() const
+	{
+		return Zones.Num();
+	}
+
+private:
+	FIntPoint GetCell(const FVector2D& Location) const;
+	void GatherZonesAt(const FVector& Location, TArray<int32, TInlineAllocator<4>>& OutZones) const;
+
+	static bool BakeZone(const AIPOI* POI, FPOIZone& OutZone);
+	static bool BuildShape(TArray<FVector>& Points, FPOIZoneShape& OutShape);
+
+	TArray<FPOIZone> Zones;
+	TMap<FIntPoint, TArray<int32>> Cells;
+	TMap<TWeakObjectPtr<AIBaseCharacter>, TArray<FPOIZoneMembership>> Memberships;
+
+	static constexpr float CellSize = 20000.f;
+};
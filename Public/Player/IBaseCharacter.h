@@ -28,6 +28,7 @@
 #include "Components/ISpringArmComponent.h"
 #include "CaveSystem/IPlayerCaveMain.h"
 #include "Interfaces/CarryInterface.h"
+#include "Net/Serialization/FastArraySerializer.h"
 #include "IBaseCharacter.generated.h"
 
 class UObject;
@@ -48,6 +49,7 @@ class AICritterPawn;
 class AIQuestItem;
 class AIMoveToQuest;
 class AIPOI;
+class UIReplicationGraph;
 
 enum class EFootstepType : uint8;
 
@@ -82,6 +84,32 @@ protected:
 	uint64 RequestId;
 };
 
+/** Identifies a single quest map marker, MarkerIndex is INDEX_NONE for the task's world location or an index into its extra map markers */
+struct FQuestMapMarkerKey
+{
+	TWeakObjectPtr<UIQuest> Quest;
+	TWeakObjectPtr<UIQuestBaseTask> Task;
+	int32 MarkerIndex = INDEX_NONE;
+
+	FQuestMapMarkerKey() = default;
+
+	FQuestMapMarkerKey(UIQuest* InQuest, UIQuestBaseTask* InTask, int32 InMarkerIndex)
+		: Quest(InQuest)
+		, Task(InTask)
+		, MarkerIndex(InMarkerIndex)
+	{}
+
+	bool operator==(const FQuestMapMarkerKey& Other) const
+	{
+		return Quest == Other.Quest && Task == Other.Task && MarkerIndex == Other.MarkerIndex;
+	}
+
+	friend uint32 GetTypeHash(const FQuestMapMarkerKey& Key)
+	{
+		return HashCombine(HashCombine(GetTypeHash(Key.Quest), GetTypeHash(Key.Task)), GetTypeHash(Key.MarkerIndex));
+	}
+};
+
 /**
  * Since FAsyncRequest is not a USTRUCT(), UHT does not know about it and whines if we try to make our USTRUCT()s derive from it.
  * The CPP definition allows us to "hide" code from the UHT. Use this definition with caution. UHT doesn't need to know about FAsyncRequest in my case.
@@ -233,6 +261,17 @@ enum class ECheckTraceType : uint8
 	CTT_NONE					UMETA(DisplayName = "None") // No trace
 };
 
+// Weapon hit that passed target filtering and is waiting on the occlusion pass of its trace set
+struct FPendingWeaponHit
+{
+	FHitResult Result;
+	AActor* HitActor = nullptr;
+	class AIBaseCharacter* HitChar = nullptr;
+
+	bool bCheckOcclusion = false;
+	bool bOccluded = false;
+};
+
 // used for blueprint editing and parsing only
 USTRUCT(BlueprintType)
 struct FDamageBodies
@@ -348,6 +387,65 @@ public:
 
 };
 
+/**
+* A single damage shape flattened out of FBodyShapes for tracing.
+*/
+struct FDamageTraceShape
+{
+	FName BoneName;
+	int32 BoneIndex = INDEX_NONE;
+	FTransform LocalTransform;
+	FCollisionShape Shape;
+};
+
+/**
+* Damage trace data compiled once per damage window from the damage bodies and the ability's timed bone groups.
+* Shapes are grouped by bone so each bone's pose is only read once per sweep.
+*/
+struct FDamageTracePlan
+{
+	TWeakObjectPtr<const UObject> Ability;
+	int32 TraceGroup = INDEX_NONE;
+
+	TArray<FDamageTraceShape> Shapes;
+
+	// Montage time of each timed bone group
+	TArray<float> GroupTimes;
+
+	// Shapes traced between group N and N + 1 are ActiveShapes[IntervalStarts[N]] up to ActiveShapes[IntervalStarts[N + 1]]
+	TArray<int32> IntervalStarts;
+	TArray<int32> ActiveShapes;
+
+	// World transforms from the last sweep, parallel to Shapes
+	TArray<FTransform> PreviousTransforms;
+	TArray<uint32> PreviousSweepIds;
+	uint32 SweepId = 0;
+
+	bool IsCompiledFor(const UObject* InAbility, const int32 InTraceGroup) const
+	{
+		return TraceGroup == InTraceGroup && Ability.Get() == InAbility && InAbility != nullptr;
+	}
+
+	void ResetPreviousTransforms()
+	{
+		// Bumping twice guarantees no stored id matches the previous sweep
+		SweepId += 2;
+	}
+
+	void Reset()
+	{
+		Ability.Reset();
+		TraceGroup = INDEX_NONE;
+		Shapes.Reset();
+		GroupTimes.Reset();
+		IntervalStarts.Reset();
+		ActiveShapes.Reset();
+		PreviousTransforms.Reset();
+		PreviousSweepIds.Reset();
+		ResetPreviousTransforms();
+	}
+};
+
 USTRUCT()
 struct FBloodMaskPixelData
 {
@@ -551,6 +649,25 @@ public:
 	int64 ExpirationUnixTime = 0; // Unix Timestamp for when this ability will expire
 };
 
+/**
+* An action bar slot resolved to its ability asset, cached until the action bar changes.
+*/
+struct FResolvedSlottedAbility
+{
+	FActionBarAbility SlottedAbility;
+	FPrimaryAssetId AbilityId;
+	TWeakObjectPtr<UPOTAbilityAsset> AbilityAsset;
+};
+
+/**
+* A saved cooldown waiting for its ability asset to finish loading.
+*/
+struct FPendingAbilityCooldown
+{
+	FSavedAbilityCooldown SavedCooldown;
+	FPrimaryAssetId AbilityId;
+};
+
 UCLASS()
 class UBreakLegsDamageType : public UDamageType { GENERATED_BODY() };
 
@@ -568,6 +685,189 @@ class UHungerThirstDamageType : public UDamageType { GENERATED_BODY() };
 
 class AIBaseCharacter;
 
+struct FReplicatedDamageParticleArray;
+struct FReplicatedCosmeticParticleArray;
+
+/**
+* A damage particle with a stable server assigned id, so clients can match their local particle components by key.
+*/
+USTRUCT()
+struct FReplicatedDamageParticle : public FFastArraySerializerItem
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY()
+	int32 ParticleId = INDEX_NONE;
+
+	UPROPERTY()
+	FDamageParticleInfo Info;
+
+	void PreReplicatedRemove(const FReplicatedDamageParticleArray& InArraySerializer);
+	void PostReplicatedAdd(const FReplicatedDamageParticleArray& InArraySerializer);
+};
+
+USTRUCT()
+struct FReplicatedDamageParticleArray : public FFastArraySerializer
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY()
+	TArray<FReplicatedDamageParticle> Items;
+
+	UPROPERTY(NotReplicated)
+	AIBaseCharacter* Owner = nullptr;
+
+	FORCEINLINE int32 Num() const { return Items.Num(); }
+	FORCEINLINE bool IsEmpty() const { return Items.IsEmpty(); }
+
+	const FReplicatedDamageParticle* FindById(const int32 ParticleId) const
+	{
+		return Items.FindByPredicate([ParticleId](const FReplicatedDamageParticle& Item) { return Item.ParticleId == ParticleId; });
+	}
+
+	void AddParticle(const FDamageParticleInfo& Info)
+	{
+		FReplicatedDamageParticle& NewItem = Items.AddDefaulted_GetRef();
+		NewItem.ParticleId = NextParticleId++;
+		NewItem.Info = Info;
+		MarkItemDirty(NewItem);
+	}
+
+	void RemoveParticleAt(const int32 Index)
+	{
+		Items.RemoveAt(Index);
+		MarkArrayDirty();
+	}
+
+	void Empty()
+	{
+		if (Items.Num() > 0)
+		{
+			Items.Empty();
+			MarkArrayDirty();
+		}
+	}
+
+	bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+	{
+		return FFastArraySerializer::FastArrayDeltaSerialize<FReplicatedDamageParticle, FReplicatedDamageParticleArray>(Items, DeltaParms, *this);
+	}
+
+private:
+	int32 NextParticleId = 0;
+};
+
+template<>
+struct TStructOpsTypeTraits<FReplicatedDamageParticleArray> : public TStructOpsTypeTraitsBase2<FReplicatedDamageParticleArray>
+{
+	enum
+	{
+		WithNetDeltaSerializer = true,
+	};
+};
+
+/**
+* A cosmetic particle with a stable server assigned id, so clients can match their local particle components by key.
+*/
+USTRUCT()
+struct FReplicatedCosmeticParticle : public FFastArraySerializerItem
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY()
+	int32 ParticleId = INDEX_NONE;
+
+	UPROPERTY()
+	FCosmeticParticleInfo Info;
+
+	void PreReplicatedRemove(const FReplicatedCosmeticParticleArray& InArraySerializer);
+	void PostReplicatedAdd(const FReplicatedCosmeticParticleArray& InArraySerializer);
+};
+
+USTRUCT()
+struct FReplicatedCosmeticParticleArray : public FFastArraySerializer
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY()
+	TArray<FReplicatedCosmeticParticle> Items;
+
+	UPROPERTY(NotReplicated)
+	AIBaseCharacter* Owner = nullptr;
+
+	FORCEINLINE int32 Num() const { return Items.Num(); }
+	FORCEINLINE bool IsEmpty() const { return Items.IsEmpty(); }
+
+	const FReplicatedCosmeticParticle* FindById(const int32 ParticleId) const
+	{
+		return Items.FindByPredicate([ParticleId](const FReplicatedCosmeticParticle& Item) { return Item.ParticleId == ParticleId; });
+	}
+
+	void AddParticle(const FCosmeticParticleInfo& Info)
+	{
+		FReplicatedCosmeticParticle& NewItem = Items.AddDefaulted_GetRef();
+		NewItem.ParticleId = NextParticleId++;
+		NewItem.Info = Info;
+		MarkItemDirty(NewItem);
+	}
+
+	/** Adds a particle unless one of the same type is already replicating, in which case that item is refreshed instead. Returns true if an item was added. */
+	bool AddOrUpdateParticle(const FCosmeticParticleInfo& Info)
+	{
+		for (FReplicatedCosmeticParticle& Item : Items)
+		{
+			if (Item.Info.CosmeticEffectType == Info.CosmeticEffectType)
+			{
+				if (!Item.Info.EffectRotation.Equals(Info.EffectRotation))
+				{
+					Item.Info = Info;
+					MarkItemDirty(Item);
+				}
+				return false;
+			}
+		}
+
+		AddParticle(Info);
+		return true;
+	}
+
+	void RemoveParticleAt(const int32 Index)
+	{
+		Items.RemoveAt(Index);
+		MarkArrayDirty();
+	}
+
+	void Empty()
+	{
+		if (Items.Num() > 0)
+		{
+			Items.Empty();
+			MarkArrayDirty();
+		}
+	}
+
+	bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+	{
+		return FFastArraySerializer::FastArrayDeltaSerialize<FReplicatedCosmeticParticle, FReplicatedCosmeticParticleArray>(Items, DeltaParms, *this);
+	}
+
+private:
+	int32 NextParticleId = 0;
+};
+
+template<>
+struct TStructOpsTypeTraits<FReplicatedCosmeticParticleArray> : public TStructOpsTypeTraitsBase2<FReplicatedCosmeticParticleArray>
+{
+	enum
+	{
+		WithNetDeltaSerializer = true,
+	};
+};
+
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnUIPausedEffectCreated);
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_FiveParams(FOnTakeDamage, float, DamageDone, float, DamageDoneRatio, const FHitResult&, HitResult, const FGameplayEffectSpec&, Spec, const FGameplayTagContainer&, SourceTags);
@@ -1282,8 +1582,21 @@ public:
 	void ServerSubmitGenericTask(FName TaskKey);
 	void ServerSubmitGenericTask_Implementation(FName TaskKey);
 
-	/** Method that allows an actor to replicate sub objects on its actor channel */
-	virtual bool ReplicateSubobjects(UActorChannel* Channel, FOutBunch* Bunch, FReplicationFlags* RepFlags) override;
+	/**
+	* Registers personal quests and their tasks as owner only replicated subobjects, removing any that are no longer held.
+	* Characters replicate subobjects from the registered list only, subclasses must register their own subobjects too.
+	*/
+	void UpdateQuestReplicatedSubObjects();
+
+	FORCEINLINE void MarkQuestReplicatedSubObjectsDirty() { bQuestReplicatedSubObjectsDirty = true; }
+
+	/** Unregisters a quest or quest task right away, called when it is destroyed so the registered list never holds a dangling pointer */
+	void RemoveQuestReplicatedSubObject(UObject* SubObject);
+
+	/** Active quests that react to LocationTag, either through their local world location or one of their explore tasks. Kept in active quest order. */
+	void GetActiveQuestsForLocation(const FName& LocationTag, TArray<UIQuest*, TInlineAllocator<4>>& OutQuests);
+
+	FORCEINLINE void MarkQuestLocationIndexDirty() { bQuestLocationIndexDirty = true; }
 
 	UFUNCTION()
 	void OnRep_ActiveQuests();
@@ -1353,6 +1666,15 @@ protected:
 	UPROPERTY(BlueprintReadWrite, ReplicatedUsing = OnRep_UncollectedRewardQuests, Category = IBaseCharacter)
 	TArray<UIQuest*> UncollectedRewardQuests;
 
+	TArray<TWeakObjectPtr<UObject>> RegisteredQuestSubObjects;
+	bool bQuestReplicatedSubObjectsDirty = false;
+
+	void RebuildQuestLocationIndex();
+
+	// LocationTag -> active quests routed to it, rebuilt lazily after quests or their tasks change
+	TMap<FName, TArray<TWeakObjectPtr<UIQuest>>> QuestLocationIndex;
+	bool bQuestLocationIndexDirty = true;
+
 public:
 
 	UPROPERTY(SaveGame, BlueprintReadOnly)
@@ -1573,7 +1895,44 @@ public:
 	UFUNCTION(BlueprintPure)
 	bool IsAttached() const;
 
+	/**
+	* Growth scaled culling, attach relevancy and group relevancy for the legacy net driver relevancy path.
+	* When UIReplicationGraph is the replication driver the same policies are pushed into the graph by the functions below.
+	*/
 	virtual bool IsNetRelevantFor(const AActor* RealViewer, const AActor* ViewTarget, const FVector& SrcLocation) const override;
+	virtual bool IsWithinNetRelevancyDistance(const FVector& SrcLocation) const override;
+
+	// NetCullDistanceSquared scaled down for juveniles, so small characters stop replicating sooner than adults of the same species
+	float GetScaledNetCullDistanceSquared() const;
+
+protected:
+	// Lowers the net update frequency while resting or sleeping and restores the previous frequency afterwards
+	void UpdateStanceNetUpdateFrequency();
+
+	// Returns the replication graph when it is the active replication driver
+	UIReplicationGraph* GetIReplicationGraph() const;
+
+	// Makes this character a dependent actor of its attach target owner in the replication graph
+	void UpdateReplicationGraphAttachDependency();
+
+	// Periodically refreshes group member dependencies and the growth scaled cull distance in the replication graph
+	void UpdateReplicationGraphPolicies();
+
+	// Pushes NetUpdateFrequency into the replication graph, which otherwise only reads it when the actor is added
+	void UpdateReplicationGraphPeriod();
+
+	// NetUpdateFrequency before resting lowered it, zero while not lowered
+	float PreRestNetUpdateFrequency = 0.f;
+
+	// Cull distance last pushed into the replication graph, zero when nothing has been pushed yet
+	float ReplicationGraphCullDistanceSquared = 0.f;
+
+	TWeakObjectPtr<AActor> ReplicationGraphAttachParent;
+	TArray<TWeakObjectPtr<AActor>> ReplicationGraphGroupParents;
+
+	FTimerHandle TimerHandle_ReplicationGraphPolicies;
+
+public:
 
 	// Blinking & Breathing
 public:
@@ -1690,6 +2049,7 @@ public:
 	UFUNCTION()
 	void OnMontageEnded(UAnimMontage* Montage, bool bInterupted);
 
+	virtual void PostInitProperties() override;
 	virtual void PostInitializeComponents() override;
 
 	//  Called to bind functionality to input
@@ -2108,6 +2468,9 @@ public:
 	void PrepareCooldownsForSave();
 	void AddCooldownsAfterLoad();
 
+	const TArray<FResolvedSlottedAbility>& GetResolvedSlottedAbilities();
+	FORCEINLINE void MarkResolvedSlottedAbilitiesDirty() { bResolvedSlottedAbilitiesDirty = true; }
+
 	void PrepareGameplayEffectsForSave();
 	void AddGameplayEffectsAfterLoad();
 
@@ -2117,6 +2480,14 @@ protected:
 
 	bool bHasRestoredSavedCooldowns = false;
 
+	// Saved cooldowns whose abilities are still loading, kept so a save in the meantime doesn't drop them
+	TArray<FPendingAbilityCooldown> PendingRestoredCooldowns;
+
+	void AddCooldownsAfterLoad_PostLoad(TSharedPtr<FStreamableHandle> Handle);
+
+	TArray<FResolvedSlottedAbility> ResolvedSlottedAbilities;
+	bool bResolvedSlottedAbilitiesDirty = true;
+
 	UPROPERTY(SaveGame)
 	TArray<FSavedGameplayEffectData> ActiveGameplayEffects;
 
@@ -4018,24 +4389,19 @@ public:
 	void ReplicateParticle(FCosmeticParticleInfo EffectInfo);
 	void GetParticleLocation(const FVector& WorldPosition, FClosestPointOnPhysicsAsset& ClosestPointOnPhysicsAsset, bool bApproximate) const;
 
-	FTimerHandle TimerHandle_CheckLocalParticles;
-	void StartCheckingLocalParticles();
-	void StopCheckingLocalParticles();
-	void CheckLocalParticles();
-
 	/************************************************************************/
 	/* Damage Particles		                                                */
 	/************************************************************************/
 
-	FORCEINLINE const TArray<FDamageParticleInfo>& GetReplicatedDamageParticles() const { return ReplicatedDamageParticles; }
+	FORCEINLINE const FReplicatedDamageParticleArray& GetReplicatedDamageParticles() const { return ReplicatedDamageParticles; }
 
-	TArray<FDamageParticleInfo>& GetReplicatedDamageParticles_Mutable();
+	FReplicatedDamageParticleArray& GetReplicatedDamageParticles_Mutable();
 
 protected:
 	
-	/* Holds hit data to replicate particles to clients */
-	UPROPERTY(Transient, ReplicatedUsing = OnRep_ReplicatedDamageParticles)
-	TArray<FDamageParticleInfo> ReplicatedDamageParticles;
+	/* Holds hit data to replicate particles to clients, keyed by a server assigned id */
+	UPROPERTY(Transient, Replicated)
+	FReplicatedDamageParticleArray ReplicatedDamageParticles;
 	
 public:
 	
@@ -4052,19 +4418,23 @@ public:
 	EDamageEffectType DamageEffectLoadingType;
 	TSharedPtr<FStreamableHandle> PreviewDamageParticleLoadHandle;
 
-	UFUNCTION()
-	void OnRep_ReplicatedDamageParticles();
+	void OnReplicatedDamageParticleAdded(const FReplicatedDamageParticle& Particle);
+	void OnReplicatedDamageParticleRemoved(const FReplicatedDamageParticle& Particle);
 
 	void RemoveReplicatedDamageParticle(EDamageEffectType DamageEffectTypeToRemove);
 	TSoftObjectPtr<UFXSystemAsset> GetDamageParticle(const FDamageParticleInfo& DamageParticleInfo);
 	void RegisterDamageParticle(FDamageParticleInfo DamageParticleInfo);
-	void LoadDamageParticle(FDamageParticleInfo DamageParticleInfo, bool bRegister = true);
-	void OnDamageParticleLoaded(FDamageParticleInfo DamageParticleInfo, bool bRegister = true);
+	void LoadDamageParticle(FDamageParticleInfo DamageParticleInfo, bool bRegister = true, int32 ParticleId = INDEX_NONE);
+	void OnDamageParticleLoaded(FDamageParticleInfo DamageParticleInfo, bool bRegister = true, int32 ParticleId = INDEX_NONE);
 	void DeregisterDamageParticle(FDamageParticleInfo DamageParticleInfo, bool bDeregisterAll = false);
+	void DeregisterDamageParticleById(int32 ParticleId);
 	void DeregisterAllDamageParticles();
 
 	UPROPERTY(BlueprintReadOnly, Category = "VFX|Damage|Death")
 	TArray<FDamageParticleInfo> LocalDamageEffectParticles;
+
+	// Replicated particle id of each entry in LocalDamageEffectParticles
+	TArray<int32> LocalDamageEffectParticleIds;
 	
 	// Used when dinosaur has a damage status outside the others
 	UPROPERTY(EditDefaultsOnly, Category = "VFX|Damage", meta=(ForceInlineRow))
@@ -4074,33 +4444,43 @@ public:
 	/* Cosmetic particles                                                   */
 	/************************************************************************/
 
-	FORCEINLINE const TArray<FCosmeticParticleInfo>& GetReplicatedCosmeticParticles() const { return ReplicatedCosmeticParticles; }
+	FORCEINLINE const FReplicatedCosmeticParticleArray& GetReplicatedCosmeticParticles() const { return ReplicatedCosmeticParticles; }
 
-	TArray<FCosmeticParticleInfo>& GetReplicatedCosmeticParticles_Mutable();	
+	FReplicatedCosmeticParticleArray& GetReplicatedCosmeticParticles_Mutable();	
 
 protected:
 	
-	/* Holds effect data to replicate particles to clients */
-	UPROPERTY(Transient, ReplicatedUsing = OnRep_ReplicatedCosmeticParticles)
-	TArray<FCosmeticParticleInfo> ReplicatedCosmeticParticles;
+	/* Holds effect data to replicate particles to clients, keyed by a server assigned id */
+	UPROPERTY(Transient, Replicated)
+	FReplicatedCosmeticParticleArray ReplicatedCosmeticParticles;
+
+	/* Number of active wetness effects, kept up to date by the ability system effect delegates */
+	int32 ActiveWetnessEffectCount = 0;
+
+	void OnWetnessEffectAdded(UAbilitySystemComponent* Target, const FGameplayEffectSpec& SpecApplied, FActiveGameplayEffectHandle ActiveHandle);
+	void OnWetnessEffectRemoved(const FActiveGameplayEffect& RemovedEffect);
 
 public:
 
 	UPROPERTY(BlueprintReadOnly, Category = "VFX|Cosmetic")
 	TArray<FCosmeticParticleInfo> LocalCosmeticEffectParticles;
 
+	// Replicated particle id of each entry in LocalCosmeticEffectParticles
+	TArray<int32> LocalCosmeticEffectParticleIds;
+
 	ECosmeticEffectType CosmeticEffectLoadingType;
 	TSharedPtr<FStreamableHandle> PreviewCosmeticParticleLoadHandle;
 
-	UFUNCTION()
-	void OnRep_ReplicatedCosmeticParticles();
+	void OnReplicatedCosmeticParticleAdded(const FReplicatedCosmeticParticle& Particle);
+	void OnReplicatedCosmeticParticleRemoved(const FReplicatedCosmeticParticle& Particle);
 
 	void RemoveReplicatedCosmeticParticle(ECosmeticEffectType CosmeticEffectTypeToRemove);
 	virtual TSoftObjectPtr<UFXSystemAsset> GetCosmeticParticle(const FCosmeticParticleInfo CosmeticParticleInfo);
 	void RegisterCosmeticParticle(FCosmeticParticleInfo CosmeticParticleInfo);
-	void LoadCosmeticParticle(FCosmeticParticleInfo CosmeticParticleInfo, bool bRegister = true);
-	void OnCosmeticParticleLoaded(FCosmeticParticleInfo CosmeticParticleInfo, bool bRegister = true);
+	void LoadCosmeticParticle(FCosmeticParticleInfo CosmeticParticleInfo, bool bRegister = true, int32 ParticleId = INDEX_NONE);
+	void OnCosmeticParticleLoaded(FCosmeticParticleInfo CosmeticParticleInfo, bool bRegister = true, int32 ParticleId = INDEX_NONE);
 	void DeregisterCosmeticParticle(FCosmeticParticleInfo CosmeticParticleInfo, bool bDeregisterAll = false);
+	void DeregisterCosmeticParticleById(int32 ParticleId);
 	void DeregisterAllCosmeticParticles();
 
 	// Used when dinosaur has a damage status outside the others
@@ -4471,12 +4851,18 @@ public:
 
 public:
 	void ProcessCompletedTraceSet(const FQueuedTraceSet& TraceSet);
-	bool ProcessDamageResultsArray(const FQueuedTraceItem& Item);
+	bool GatherDamageHitResults(const FQueuedTraceItem& Item, TArray<FPendingWeaponHit, TInlineAllocator<16>>& OutHits);
 
 	FGameplayEventData GenerateEventData(const FHitResult& Result, const FWeaponDamageConfiguration& DamageConfig);
 	void ProcessDamageEvent(const FGameplayEventData& EventData, const FWeaponDamageConfiguration& DamageConfig);
 
-	bool ProcessDamageHitResult(FHitResult Result, const FQueuedTraceItem& Item);
+	// Filters and deduplicates a single hit, queueing it in OutHits. Returns true for a new blocking hit.
+	bool GatherDamageHitResult(const FHitResult& Result, const FQueuedTraceItem& Item, TArray<FPendingWeaponHit, TInlineAllocator<16>>& OutHits);
+
+	// Runs the visibility traces of every pending hit in one pass
+	void ResolvePendingDamageHitOcclusion(TArrayView<FPendingWeaponHit> Hits);
+
+	void ApplyPendingDamageHit(const FPendingWeaponHit& Hit);
 
 	UFUNCTION(Client, Reliable)
 	void Client_ProcessEvent(const FGameplayEventData& EventData);
@@ -4521,7 +4907,9 @@ protected:
 
 	void DoDamageSweeps(const float DeltaTime);
 
-	bool QueueShapeTraces(UWorld* World, const TArray<FTimedTraceBoneGroup> SectionBones, const FCollisionQueryParams& TraceParams, const float CurrentMontageTime, const float DeltaTime, bool bStopOnBlock = true);
+	void CompileDamageTracePlan(UPOTGameplayAbility* AttackAbility);
+
+	bool QueueShapeTraces(UWorld* World, const FCollisionQueryParams& TraceParams, const float CurrentMontageTime, const float DeltaTime, bool bStopOnBlock = true);
 
 	void QueueTraces(const FQueuedTraceSet& QueueSet);
 
@@ -4536,7 +4924,7 @@ protected:
 #endif
 
 private:
-	TArray<TWeakObjectPtr<AActor>, TInlineAllocator<16>> DamagedActors;
+	TSet<TWeakObjectPtr<AActor>, DefaultKeyFuncs<TWeakObjectPtr<AActor>>, TInlineSetAllocator<16>> DamagedActors;
 	TMap<TWeakObjectPtr<AActor>, float, TInlineSetAllocator<16>> LastFramesDamagedActors;
 
 	UPROPERTY(Transient)
@@ -4553,8 +4941,7 @@ private:
 	UPROPERTY(Transient)
 	TArray<FTimedTraceBoneGroup> CurrentSectionBones;
 
-	UPROPERTY(Transient)
-	TArray<FAlderonBoneData> PreviousBoneData;
+	FDamageTracePlan DamageTracePlan;
 	
 	float LastHitTime;
 	int DamageSweepsCounter;
@@ -4636,7 +5023,8 @@ protected:
 
 	FMapMarkerInfo SurvivalMapMarker = FMapMarkerInfo();
 	TArray<FMapMarkerInfo> CritterBurrowMapMarkers;
-	TArray<FMapMarkerInfo> QuestMapMarkers;
+	// Quest markers currently shown on the map, UpdateQuestMarker only sends the differences against this set
+	TMap<FQuestMapMarkerKey, FMapMarkerInfo> QuestMapMarkers;
 
 	FTimerHandle TimerHandle_NearestItem;
 	FTimerHandle TimerHandle_NearestBurrow;
@@ -12,6 +12,7 @@
 
 class AIBaseCharacter;
 class AIPlayerGroupActor;
+class UPOTAbilitySystemComponent;
 
 USTRUCT(BlueprintType)
 struct FTutorialPrompt
@@ -207,6 +208,41 @@ public:
 	TArray<FName> RequireQuestTags;
 };
 
+/** Tags of every member in a group, gathered once so group quest checks are lookups rather than per member queries */
+struct PATHOFTITANS_API FGroupQuestTags
+{
+public:
+	void Reset();
+	void AddMember(const AIBaseCharacter* Character);
+
+	// True if every member has QuestTag, NAME_None always passes
+	bool AllMembersHaveQuestTag(const FName& QuestTag) const;
+
+	// Quest tags that every member has
+	void GetSharedQuestTags(TArray<FName, TInlineAllocator<3>>& OutQuestTags) const;
+
+	// True if a single member has any of RequiredTags and all of RequiredQuestTags
+	bool AnyMemberMatches(const FGameplayTagContainer& RequiredTags, const TArray<FName>& RequiredQuestTags) const;
+
+	FORCEINLINE int32 NumMembers() const { return Members.Num(); }
+
+private:
+	struct FMemberTags
+	{
+		FGameplayTag CharacterTag;
+
+		// Character tags and owned gameplay tags
+		FGameplayTagContainer GameplayTags;
+
+		TArray<FName> QuestTags;
+	};
+
+	TArray<FMemberTags> Members;
+
+	// Number of members holding each quest tag
+	TMap<FName, int32> QuestTagCounts;
+};
+
 UCLASS(BlueprintType)
 class PATHOFTITANS_API UQuestData : public UPrimaryDataAsset
 {
@@ -371,6 +407,12 @@ public:
 	virtual void Update(AIBaseCharacter* QuestOwner, UIQuest* ActiveQuest) {};
 	virtual void Setup() override;
 
+	// Authority Only. Called when the task or its quest is removed from play, the object may still be kept alive for rewards or other group members.
+	virtual void OnQuestRemoved() {};
+
+	virtual void PostInitProperties() override;
+	virtual void BeginDestroy() override;
+
 	UFUNCTION(BlueprintCallable, Category = Quest)
 	virtual FText GetTaskText(bool bShowProgress = true) { return FText::FromString("Unknown"); }
 
@@ -470,15 +512,22 @@ public:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = QuestPersonalStat)
 	float CompletePercentage;
 
+	// Called on the class default object. Registers a start threshold watch on the character the first time and reads its state afterwards.
 	virtual bool MeetsStartRequirements(AIBaseCharacter* QuestOwner);
 
 	virtual void Update(AIBaseCharacter* QuestOwner, UIQuest* ActiveQuest) override;
 
+	virtual void OnQuestRemoved() override;
+	virtual void BeginDestroy() override;
+
 	virtual FText GetTaskText(bool bShowProgress = true) override { return TaskText; }
 	
 	virtual bool IsCompleted() const override { return bCompleted; }
 
 	void SetIsCompleted(bool bNewCompleted);
+
+	// Character whose attributes are tracked by this task
+	virtual AIBaseCharacter* GetStatCharacter(AIBaseCharacter* QuestOwner) const { return QuestOwner; }
 	
 protected:
 	
@@ -487,6 +536,12 @@ protected:
 
 	UFUNCTION()
 	void OnRep_Completed();
+
+	void OnCompletionThresholdCrossed();
+	void ReleaseCompletionWatch();
+
+	TWeakObjectPtr<UPOTAbilitySystemComponent> CompletionWatchAbilitySystem;
+	int32 CompletionWatchHandle = INDEX_NONE;
 };
 
 UCLASS(BlueprintType, Blueprintable)
@@ -501,7 +556,7 @@ public:
 	UPROPERTY(BlueprintReadOnly, Category = QuestFeedMember)
 	AIBaseCharacter* TargetMember = nullptr;
 
-	virtual void Update(AIBaseCharacter* QuestOwner, UIQuest* ActiveQuest) override;
+	virtual AIBaseCharacter* GetStatCharacter(AIBaseCharacter* QuestOwner) const override { return TargetMember; }
 
 	virtual void Setup() { UIQuestBaseTask::Setup(); }
 
@@ -857,6 +912,9 @@ public:
 	void SetPlayerGroupActor(AIPlayerGroupActor* NewPlayerGroupActor);
 
 protected:
+
+	// Tells an owning character that its registered quest subobjects and quest location index need updating
+	void MarkOwnerSubObjectsDirty();
 	
 	UPROPERTY(BlueprintReadWrite, SaveGame, Replicated, Category = Quest)
 	FPrimaryAssetId QuestId;
@@ -947,6 +1005,9 @@ public:
 	// Authority Only
 	void CheckCompletion();
 
+	// Authority Only. Lets the tasks release anything they registered on a character once the quest is removed from its active quests.
+	void OnRemovedFromActiveQuests();
+
 	FText GetRemainingTimeText();
 	float GetContributionAsNumber(AIBaseCharacter* TargetCharacter = nullptr);
 	FText GetContributionText(AIBaseCharacter* TargetCharacter = nullptr);
@@ -4,10 +4,12 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
+#include "Async/Future.h"
 #include "ITypes.h"
 #include "Quests/IQuest.h"
 #include "World/IWaterManager.h"
 #include "World/IWaystoneManager.h"
+#include "Quests/IPOIZoneGrid.h"
 #include "IQuestManager.generated.h"
 
 USTRUCT(BlueprintType)
@@ -182,6 +184,7 @@ public:
 	void SaveContributionData();
 
 	void OnSaveContributionData(TArray<FPrimaryAssetId> QuestAssetIds);
+	void OnContributionDataSaved(const FString& SlotName, const int32 UserIndex, bool bSuccess);
 
 	FString GetSaveSlotName();
 	FString GetMapName();
@@ -190,6 +193,12 @@ protected:
 	void QuestTick();
 	void QuestTock();
 	void OnQuestTock(AIBaseCharacter* OwningCharacter, FPrimaryAssetId QuestAssetId);
+
+	// Hands out a survival quest if the character has left the hatchling cave and does not have one yet
+	void TryAssignSurvivalQuest(AIBaseCharacter* OwningCharacter);
+
+	// Characters whose survival stat start thresholds were crossed since the last quest tick
+	TArray<TWeakObjectPtr<AIBaseCharacter>> PendingSurvivalQuestChecks;
 	void ContributionTick();
 	void CooldownTick();
 
@@ -198,10 +207,33 @@ protected:
 	FTimerHandle TimerHandle_ContributionTick;
 	FTimerHandle TimerHandle_CooldownTick;
 
+	// Only one asynchronous contribution save is written at a time, a save requested meanwhile is written after it
+	bool bContributionSaveInFlight = false;
+	bool bContributionSavePending = false;
+
+	// File write of the in flight contribution save, waited on before a synchronous save so it can't land afterwards
+	TFuture<void> ContributionSaveTask;
+
+	void POIZoneTick();
+
+	FTimerHandle TimerHandle_POIZoneTick;
+
+	// Server side POI membership, replaces client reported POI overlaps on dedicated servers
+	FPOIZoneGrid POIZoneGrid;
+
+	// Set by the server once POIZoneGrid was built with zones, clients stop reporting POI overlaps while this is set
+	UPROPERTY(Replicated)
+	bool bResolvingPOIZones = false;
+
 public:
 
+	FORCEINLINE bool IsResolvingPOIZones() const { return bResolvingPOIZones; }
+
 	bool IsPoiCompatibleForExploration(AActor* Poi, AIBaseCharacter* Character) const;
 
+	// Called from survival stat threshold watches, the check itself is deferred to the next quest tick
+	void QueueSurvivalQuestCheck(AIBaseCharacter* Character);
+
 	void GetRandomQuest(AIBaseCharacter* Character, FQuestIDLoaded QuestIDLoaded, EQuestShareType PreferredType = EQuestShareType::Unknown);
 	bool HasRoomForQuest(const AIBaseCharacter* Character, const EQuestShareType PreferredType, EQuestType& ActivePersonalQuestType);
 	void OnGetRandomQuest(AIBaseCharacter* Character, EQuestShareType PreferredType, EQuestType ActivePersonalQuestType, TArray<FPrimaryAssetId> Quests, FQuestIDLoaded QuestIDLoaded);
@@ -209,6 +241,9 @@ public:
 	void OnGetRandomGroupQuest(EQuestFilter QuestFilter, TArray<FPrimaryAssetId> Quests, AIPlayerGroupActor* PlayerGroupActor, FQuestIDLoaded QuestIDLoaded, float MinGrowthInGroup, TArray<FName, TInlineAllocator<3>> QuestTags);
 	void GetLocalWorldQuests(AIBaseCharacter* Character, FQuestsDataLoaded OnLoadAssetsDelegate);
 
+	// Cheap check before loading local world quests, true if any of them can be handed out at LocationTag
+	bool HasLocalWorldQuestsForLocation(FName LocationTag) const;
+
 	void FilterOnLocalWorldQuestsLoaded(TArray<UQuestData*> QuestsData, AIBaseCharacter* Character, FQuestsDataLoaded OnLoadAssetsDelegate);
 	void GetQuestByName(const FString& DisplayName, FQuestIDLoaded QuestIDLoaded, const AIBaseCharacter* Character = nullptr);
 
@@ -241,7 +276,7 @@ public:
 	bool ShouldAssignGroupMeetQuest(AIPlayerGroupActor* PlayerGroupActor) const;
 	void AssignGroupMeetQuest(AIPlayerGroupActor* PlayerGroupActor);
 
-	bool DoGroupMembersContainQuestTag(TArrayView<const AIBaseCharacter*> GroupMemberCharacters, const FName& QuestTag) const;
+	bool DoGroupMembersContainQuestTag(const FGroupQuestTags& GroupTags, const FName& QuestTag) const;
 
 	void UpdateGroupQuestsOnCooldown(FAlderonUID CharacterID, FPrimaryAssetId QuestId);
 	void ClearCompletedQuests(AIBaseCharacter* TargetCharacter);
@@ -467,6 +502,10 @@ public:
 	TArray<FPrimaryAssetId> WaystoneRestoreQuests;
 	TArray<FPrimaryAssetId> LocalWorldQuests;
 
+	// Locations local world quests can be assigned in, filled as quests are added
+	TSet<FName> LocalWorldQuestLocationTags;
+	bool bHasUnlocatedLocalWorldQuests = false;
+
 	// Dinosaur Unique Quests
 	TArray<FPrimaryAssetId> SingleUniqueQuests;
 	TArray<FPrimaryAssetId> MultiUniqueQuests;